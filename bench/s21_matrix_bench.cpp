@@ -0,0 +1,326 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "../s21_allocator.h"
+#include "../s21_cholesky.h"
+#include "../s21_fixed_matrix.h"
+#include "../s21_lu.h"
+#include "../s21_matrix_batch.h"
+#include "../s21_matrix_oop.h"
+#include "../s21_qr.h"
+#include "../s21_simd.h"
+#include "../s21_sparse_matrix.h"
+#include "../s21_vector.h"
+
+namespace {
+
+S21Matrix RandomMatrix(int rows, int cols, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  S21Matrix result(rows, cols);
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) {
+      result(i, j) = dist(gen);
+    }
+  }
+  return result;
+}
+
+// Лучшее время из нескольких прогонов; flops == 0 — печатаем только время.
+void Measure(const char *name, int n, double flops,
+             const std::function<void()> &body) {
+  using Clock = std::chrono::steady_clock;
+  const int repeats = n <= 512 ? 5 : 2;
+  double best = 1e300;
+  for (int r = 0; r < repeats; r++) {
+    auto start = Clock::now();
+    body();
+    std::chrono::duration<double> elapsed = Clock::now() - start;
+    if (elapsed.count() < best) best = elapsed.count();
+  }
+  if (flops > 0) {
+    std::printf("%-22s n=%-6d %10.3f ms %8.2f GFLOP/s\n", name, n,
+                best * 1e3, flops / best * 1e-9);
+  } else {
+    std::printf("%-22s n=%-6d %10.3f ms\n", name, n, best * 1e3);
+  }
+}
+
+void BenchMulMatrix(int n) {
+  S21Matrix a = RandomMatrix(n, n, 1);
+  S21Matrix b = RandomMatrix(n, n, 2);
+  const double flops = 2.0 * n * n * n;
+  Measure("MulMatrix", n, flops, [&] {
+    S21Matrix c(a);
+    c.MulMatrix(b);
+  });
+  Measure("MulMatrix (Strassen)", n, flops, [&] {
+    S21Matrix c(a);
+    c.MulMatrix(b, S21Matrix::MulAlgorithm::kStrassen);
+  });
+  // Нечётный размер: операнды дополняются нулями до чётных блоков.
+  const int odd = n + 1;
+  S21Matrix c = RandomMatrix(odd, odd, 3);
+  S21Matrix d = RandomMatrix(odd, odd, 4);
+  const double odd_flops = 2.0 * odd * odd * odd;
+  Measure("MulMatrix", odd, odd_flops, [&] {
+    S21Matrix e(c);
+    e.MulMatrix(d);
+  });
+  Measure("MulMatrix (Strassen)", odd, odd_flops, [&] {
+    S21Matrix e(c);
+    e.MulMatrix(d, S21Matrix::MulAlgorithm::kStrassen);
+  });
+}
+
+// Шаг итерационного метода: c += alpha * a * b операторами и одним Gemm.
+void BenchGemm(int n) {
+  S21Matrix a = RandomMatrix(n, n, 13);
+  S21Matrix b = RandomMatrix(n, n, 14);
+  S21Matrix c = RandomMatrix(n, n, 15);
+  const double flops = 2.0 * n * n * n;
+  Measure("c += a * b * 1e-3", n, flops, [&] { c += a * b * 1e-3; });
+  Measure("c.Gemm(1e-3, a, b, 1)", n, flops, [&] { c.Gemm(1e-3, a, b, 1.0); });
+}
+
+// Шаг итерационного метода: A x и A^T x столбцом S21Matrix и S21Vector.
+void BenchGemv(int n) {
+  const S21Matrix a = RandomMatrix(n, n, 18);
+  const S21Matrix column = RandomMatrix(n, 1, 19);
+  const S21Matrix row = RandomMatrix(1, n, 19);
+  S21Vector x(n);
+  for (int i = 0; i < n; i++) x(i) = column(i, 0);
+  const double flops = 2.0 * n * n;
+  S21Matrix c;
+  Measure("a * column", n, flops, [&] { c = a * column; });
+  Measure("row * a", n, flops, [&] { c = row * a; });
+  S21Vector y(n);
+  Measure("y.Gemv(a, x)", n, flops, [&] { y.Gemv(1.0, a, x, 0.0); });
+  Measure("y.Gemv(a^T, x)", n, flops, [&] { y.Gemv(1.0, a, x, 0.0, true); });
+}
+
+void BenchDeterminant(int n) {
+  S21Matrix a = RandomMatrix(n, n, 3);
+  const double flops = 2.0 / 3.0 * n * n * n;
+  Measure("Determinant", n, flops, [&] { a.Determinant(); });
+}
+
+void BenchInverseMatrix(int n) {
+  S21Matrix a = RandomMatrix(n, n, 4);
+  const double flops = 2.0 * n * n * n;
+  Measure("InverseMatrix", n, flops, [&] { a.InverseMatrix(); });
+}
+
+// Симметричная положительно определённая: LU против Холецкого.
+void BenchCholesky(int n) {
+  const S21Matrix m = RandomMatrix(n, n, 13);
+  S21Matrix a(n, n);
+  a.Gemm(1.0, m, m, 0.0, false, true);
+  for (int i = 0; i < n; i++) a(i, i) += n;
+  const double flops = static_cast<double>(n) * n * n / 3.0;
+  Measure("Determinant (LU)", n, 2.0 * flops, [&] { a.Determinant(); });
+  Measure("S21Cholesky", n, flops, [&] { S21Cholesky cholesky(a); });
+  Measure("Cholesky inverse", n, 0.0,
+          [&] { S21Cholesky(a).InverseMatrix(); });
+}
+
+// Одна правая часть: обращение против факторизации и повторного решения.
+void BenchSolve(int n) {
+  const S21Matrix a = RandomMatrix(n, n, 14);
+  const S21Matrix b = RandomMatrix(n, 1, 15);
+  S21Matrix x;
+  Measure("InverseMatrix() * b", n, 0.0,
+          [&] { x = S21MatrixView(a).InverseMatrix() * b; });
+  Measure("Solve(a, b)", n, 0.0, [&] { x = S21MatrixView(a).Solve(b); });
+  const S21Lu lu(a);
+  Measure("S21Lu::SolveInPlace", n, 2.0 * n * n, [&] {
+    x = b;
+    lu.SolveInPlace(x);
+  });
+}
+
+// Переопределённая система 4k x k: QR против нормальных уравнений.
+void BenchLeastSquares(int n) {
+  const int cols = std::max(1, n / 4);
+  const S21Matrix a = RandomMatrix(n, cols, 16);
+  const S21Matrix b = RandomMatrix(n, 1, 17);
+  const S21MatrixView view(a);
+  S21Matrix x;
+  Measure("Normal equations", n, 0.0, [&] {
+    S21Matrix at = view.Transpose();
+    x = (at * a).InverseMatrix() * (at * b);
+  });
+  Measure("S21Qr::Solve", n, 0.0, [&] { x = S21Qr(a).Solve(b); });
+}
+
+void BenchCalcComplements(int n) {
+  S21Matrix a = RandomMatrix(n, n, 5);
+  Measure("CalcComplements", n, 0.0, [&] { a.CalcComplements(); });
+}
+
+void BenchElementwise(int n) {
+  S21Matrix a = RandomMatrix(n, n, 6);
+  S21Matrix b = RandomMatrix(n, n, 7);
+  S21Matrix c = RandomMatrix(n, n, 8);
+  S21Matrix r(n, n);
+  Measure("a + b - c * 2.0", n, 0.0, [&] { r = a + b - c * 2.0; });
+}
+
+void BenchSumMatrix(int n) {
+  S21Matrix a = RandomMatrix(n, n, 9);
+  S21Matrix b = RandomMatrix(n, n, 10);
+  Measure("SumMatrix", n, 0.0, [&] { a.SumMatrix(b); });
+  Measure("MulNumber", n, 0.0, [&] { a.MulNumber(0.5); });
+  // Полный проход: матрицы равны, ранний выход не срабатывает.
+  S21Matrix c(a);
+  bool equal = true;
+  Measure("EqMatrix absolute", n, 0.0, [&] { equal &= a.EqMatrix(c); });
+  Measure("EqMatrix relative", n, 0.0, [&] {
+    equal &= a.EqMatrix(c, S21Matrix::Tolerance::Relative(1e-12));
+  });
+  Measure("EqMatrix ulp", n, 0.0, [&] {
+    equal &= a.EqMatrix(c, S21Matrix::Tolerance::Ulp(4));
+  });
+  if (!equal) std::printf("\n");
+}
+
+void BenchTranspose(int n) {
+  S21Matrix a = RandomMatrix(n, n, 12);
+  Measure("Transpose", n, 0.0, [&] { a.Transpose(); });
+  Measure("TransposeInPlace", n, 0.0, [&] { a.TransposeInPlace(); });
+}
+
+// Миллион произведений и определителей 3x3: куча против S21FixedMatrix.
+// Пять ненулевых элементов на строку: CSR против плотного GEMM.
+void BenchSparse(int n) {
+  S21Matrix dense(n, n);
+  for (int i = 0; i < n; i++) {
+    for (int k = 0; k < 5; k++) dense(i, (i * 31 + k * 97) % n) = 1.0 + k;
+  }
+  const S21SparseMatrix sparse(dense);
+  const S21Matrix b = RandomMatrix(n, n, 12);
+  const std::vector<double> x(n, 1.0);
+  Measure("dense * dense (sparse)", n, 0.0, [&] { dense * b; });
+  Measure("CSR * dense", n, 0.0, [&] { sparse * b; });
+  Measure("CSR * vector", n, 0.0, [&] { sparse * x; });
+}
+
+// Потоковое наполнение: n строк по одной через SetRows.
+void BenchAppendRows(int n) {
+  Measure("SetRows append", n, 0.0, [&] {
+    S21Matrix m(1, n);
+    for (int i = 1; i < n; i++) {
+      m.SetRows(i + 1);
+      m(i, 0) = i;
+    }
+  });
+}
+
+// Пакет из 4096 разных матриц (помещается в L2) обрабатывается
+// count / 4096 раз; для сравнения — тот же цикл по S21FixedMatrix.
+void BenchBatches(int count, double &sink) {
+  constexpr int kSize = 4096;
+  const int repeats = count / kSize;
+  std::vector<S21FixedMatrix<3, 3>> fixed3(kSize);
+  std::vector<S21FixedMatrix<4, 4>> fixed4(kSize);
+  S21MatrixBatch<3> batch3(kSize);
+  S21MatrixBatch<4> batch4(kSize);
+  for (int k = 0; k < kSize; k++) {
+    fixed3[k] = S21FixedMatrix<3, 3>(RandomMatrix(3, 3, k));
+    fixed4[k] = S21FixedMatrix<4, 4>(RandomMatrix(4, 4, k));
+    batch3.Set(k, fixed3[k]);
+    batch4.Set(k, fixed4[k]);
+  }
+  Measure("3x3 fixed mul+det", count, 0.0, [&] {
+    for (int r = 0; r < repeats; r++) {
+      for (const S21FixedMatrix<3, 3> &m : fixed3) {
+        sink += (m * m).Determinant();
+      }
+    }
+  });
+  Measure("3x3 batch mul+det", count, 0.0, [&] {
+    for (int r = 0; r < repeats; r++) {
+      S21MatrixBatch<3> product(batch3);
+      product.MulMatrix(batch3);
+      sink += product.Determinant()[0];
+    }
+  });
+  Measure("4x4 fixed inverse", count, 0.0, [&] {
+    for (int r = 0; r < repeats; r++) {
+      for (const S21FixedMatrix<4, 4> &m : fixed4) {
+        sink += m.InverseMatrix()(0, 0);
+      }
+    }
+  });
+  Measure("4x4 batch inverse", count, 0.0, [&] {
+    for (int r = 0; r < repeats; r++) {
+      sink += batch4.InverseMatrix()(0, 0, 0);
+    }
+  });
+}
+
+void BenchSmallMatrices() {
+  const int count = 1000000;
+  S21Matrix a = RandomMatrix(3, 3, 11);
+  S21FixedMatrix<3, 3> fixed(a);
+  double sink = 0.0;
+  Measure("3x3 S21Matrix", count, 0.0, [&] {
+    for (int k = 0; k < count; k++) {
+      S21Matrix product = a * a;
+      sink += product.Determinant();
+    }
+  });
+  s21::MatrixAllocator &previous =
+      s21::SetMatrixAllocator(s21::PoolAllocator::Instance());
+  Measure("3x3 S21Matrix (pool)", count, 0.0, [&] {
+    for (int k = 0; k < count; k++) {
+      S21Matrix product = a * a;
+      sink += product.Determinant();
+    }
+  });
+  s21::SetMatrixAllocator(previous);
+  Measure("3x3 S21FixedMatrix", count, 0.0, [&] {
+    for (int k = 0; k < count; k++) {
+      fixed(0, 0) += 1e-9;
+      sink += (fixed * fixed).Determinant();
+    }
+  });
+  BenchBatches(count, sink);
+  if (sink == 0.0) std::printf("\n");
+}
+
+}  // namespace
+
+// Использование: s21_bench_matrix [n ...]; по умолчанию 256 512 1024.
+int main(int argc, char **argv) {
+  std::vector<int> sizes;
+  for (int i = 1; i < argc; i++) {
+    sizes.push_back(std::atoi(argv[i]));
+  }
+  if (sizes.empty()) sizes = {256, 512, 1024};
+  std::printf("simd: %s\n", s21::simd::IsaName(s21::simd::ActiveIsa()));
+  BenchSmallMatrices();
+  for (int n : sizes) {
+    if (n <= 0) continue;
+    BenchMulMatrix(n);
+    BenchGemm(n);
+    BenchGemv(n);
+    BenchDeterminant(n);
+    BenchInverseMatrix(n);
+    BenchCholesky(n);
+    BenchSolve(n);
+    BenchLeastSquares(n);
+    BenchCalcComplements(n);
+    BenchElementwise(n);
+    BenchSumMatrix(n);
+    BenchTranspose(n);
+    BenchAppendRows(n);
+    BenchSparse(n);
+  }
+  return 0;
+}
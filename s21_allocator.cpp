@@ -0,0 +1,187 @@
+#include "s21_allocator.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace s21 {
+
+namespace {
+
+constexpr std::size_t kBlockAlignment = 64;
+constexpr std::size_t kMinClassBytes = 256;
+// 256 Б ... 32 МиБ: по четыре класса (1, 1.25, 1.5, 1.75) * 2^k.
+constexpr int kClassCount = 69;
+
+constexpr std::array<std::size_t, kClassCount> MakeClassSizes() {
+  std::array<std::size_t, kClassCount> sizes{};
+  std::size_t base = kMinClassBytes;
+  for (int c = 0; c < kClassCount; c++) {
+    sizes[c] = base + base / 4 * (c % 4);
+    if (c % 4 == 3) base *= 2;
+  }
+  return sizes;
+}
+
+constexpr std::array<std::size_t, kClassCount> kClassSizes = MakeClassSizes();
+static_assert(kClassSizes.back() == PoolAllocator::kMaxPooledBytes);
+
+// Наименьший класс, вмещающий bytes, или -1 для слишком больших блоков.
+int ClassOf(std::size_t bytes) {
+  auto it = std::lower_bound(kClassSizes.begin(), kClassSizes.end(), bytes);
+  return it == kClassSizes.end() ? -1
+                                 : static_cast<int>(it - kClassSizes.begin());
+}
+
+void *HeapNew(std::size_t bytes) {
+  return ::operator new(bytes, std::align_val_t(kBlockAlignment));
+}
+
+void HeapDelete(void *block) {
+  ::operator delete(block, std::align_val_t(kBlockAlignment));
+}
+
+// Поток завершился, его кэш уничтожен: блоки идут прямо в кучу.
+thread_local bool cache_destroyed = false;
+
+// Свободные блоки каждого класса — односвязный список, указатель на
+// следующий блок хранится в начале самого блока (кэш не выделяет память).
+struct ThreadCache {
+  std::array<void *, kClassCount> heads{};
+  std::size_t bytes = 0;
+  // Счётчик bytes_cached пула, в который ведётся учёт.
+  std::atomic<std::size_t> *cached = nullptr;
+
+  void Push(int c, void *block) {
+    *static_cast<void **>(block) = heads[c];
+    heads[c] = block;
+    bytes += kClassSizes[c];
+  }
+
+  void *Pop(int c) {
+    void *block = heads[c];
+    if (block != nullptr) {
+      heads[c] = *static_cast<void **>(block);
+      bytes -= kClassSizes[c];
+    }
+    return block;
+  }
+
+  void Release() {
+    for (int c = 0; c < kClassCount; c++) {
+      for (void *block = Pop(c); block != nullptr; block = Pop(c)) {
+        if (cached != nullptr) cached->fetch_sub(kClassSizes[c]);
+        HeapDelete(block);
+      }
+    }
+  }
+
+  ~ThreadCache() {
+    Release();
+    cache_destroyed = true;
+  }
+};
+
+ThreadCache &Cache() {
+  thread_local ThreadCache cache;
+  return cache;
+}
+
+MatrixAllocator *InitialAllocator() {
+  MatrixAllocator *result = &HeapAllocator::Instance();
+  const char *env = std::getenv("S21_ALLOCATOR");
+  if (env != nullptr && std::strcmp(env, "pool") == 0) {
+    result = &PoolAllocator::Instance();
+  }
+  return result;
+}
+
+// Локальная статическая переменная: матрицы из статических объектов
+// других единиц трансляции могут создаваться раньше этого файла.
+std::atomic<MatrixAllocator *> &Current() {
+  static std::atomic<MatrixAllocator *> current{InitialAllocator()};
+  return current;
+}
+
+}  // namespace
+
+HeapAllocator &HeapAllocator::Instance() {
+  static HeapAllocator allocator;
+  return allocator;
+}
+
+void *HeapAllocator::Allocate(std::size_t bytes) {
+  void *block = HeapNew(bytes);
+  allocations_.fetch_add(1, std::memory_order_relaxed);
+  bytes_in_use_.fetch_add(bytes, std::memory_order_relaxed);
+  return block;
+}
+
+void HeapAllocator::Deallocate(void *block, std::size_t bytes) {
+  HeapDelete(block);
+  deallocations_.fetch_add(1, std::memory_order_relaxed);
+  bytes_in_use_.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+AllocatorStats HeapAllocator::GetStats() const {
+  const std::size_t allocations = allocations_.load();
+  return {allocations, deallocations_.load(), 0, allocations,
+          bytes_in_use_.load(), 0};
+}
+
+PoolAllocator &PoolAllocator::Instance() {
+  static PoolAllocator allocator;
+  return allocator;
+}
+
+void *PoolAllocator::Allocate(std::size_t bytes) {
+  const int c = ClassOf(bytes);
+  void *block = c >= 0 && !cache_destroyed ? Cache().Pop(c) : nullptr;
+  if (block != nullptr) {
+    bytes_cached_.fetch_sub(kClassSizes[c], std::memory_order_relaxed);
+    reused_.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    block = HeapNew(c >= 0 ? kClassSizes[c] : bytes);
+    heap_allocations_.fetch_add(1, std::memory_order_relaxed);
+  }
+  allocations_.fetch_add(1, std::memory_order_relaxed);
+  bytes_in_use_.fetch_add(bytes, std::memory_order_relaxed);
+  return block;
+}
+
+// Блок может вернуться в кэш другого потока, чем тот, что его выделил:
+// размер класса определяется по bytes, а не по владельцу.
+void PoolAllocator::Deallocate(void *block, std::size_t bytes) {
+  const int c = ClassOf(bytes);
+  if (c >= 0 && !cache_destroyed &&
+      Cache().bytes + kClassSizes[c] <= kMaxCachedBytes) {
+    ThreadCache &cache = Cache();
+    cache.cached = &bytes_cached_;
+    cache.Push(c, block);
+    bytes_cached_.fetch_add(kClassSizes[c], std::memory_order_relaxed);
+  } else {
+    HeapDelete(block);
+  }
+  deallocations_.fetch_add(1, std::memory_order_relaxed);
+  bytes_in_use_.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+AllocatorStats PoolAllocator::GetStats() const {
+  return {allocations_.load(), deallocations_.load(), reused_.load(),
+          heap_allocations_.load(), bytes_in_use_.load(),
+          bytes_cached_.load()};
+}
+
+void PoolAllocator::Trim() {
+  if (!cache_destroyed) Cache().Release();
+}
+
+MatrixAllocator &GetMatrixAllocator() { return *Current().load(); }
+
+MatrixAllocator &SetMatrixAllocator(MatrixAllocator &allocator) {
+  return *Current().exchange(&allocator);
+}
+
+}  // namespace s21
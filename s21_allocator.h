@@ -0,0 +1,88 @@
+#ifndef S21_ALLOCATOR_H
+#define S21_ALLOCATOR_H
+
+#include <atomic>
+#include <cstddef>
+
+namespace s21 {
+
+struct AllocatorStats {
+  std::size_t allocations;
+  std::size_t deallocations;
+  // Выдано из кэша без обращения к глобальной куче.
+  std::size_t reused;
+  // Обращения к глобальной куче (::operator new).
+  std::size_t heap_allocations;
+  // Запрошено и ещё не возвращено.
+  std::size_t bytes_in_use;
+  // Лежит в кэшах в ожидании повторного использования.
+  std::size_t bytes_cached;
+};
+
+// Источник памяти для хранилища S21Matrix. Блоки выровнены на 64 байта.
+// Матрица запоминает аллокатор, из которого взят её блок, и возвращает
+// блок туда же, поэтому аллокатор должен жить дольше своих матриц.
+class MatrixAllocator {
+ public:
+  virtual ~MatrixAllocator() = default;
+  virtual void *Allocate(std::size_t bytes) = 0;
+  // bytes — тот же размер, что был передан в Allocate.
+  virtual void Deallocate(void *block, std::size_t bytes) = 0;
+  virtual AllocatorStats GetStats() const = 0;
+};
+
+// Глобальная куча, как у new[]: каждая матрица — отдельный вызов.
+class HeapAllocator : public MatrixAllocator {
+ public:
+  static HeapAllocator &Instance();
+
+  void *Allocate(std::size_t bytes) override;
+  void Deallocate(void *block, std::size_t bytes) override;
+  AllocatorStats GetStats() const override;
+
+ private:
+  HeapAllocator() = default;
+
+  std::atomic<std::size_t> allocations_{0};
+  std::atomic<std::size_t> deallocations_{0};
+  std::atomic<std::size_t> bytes_in_use_{0};
+};
+
+// Пул с классами размеров (четыре класса на каждую степень двойки) и
+// кэшем свободных блоков в каждом потоке: временные матрицы одного
+// размера переиспользуют блоки без блокировок и без обращения к куче.
+// Блоки больше kMaxPooledBytes и блоки сверх kMaxCachedBytes на поток
+// идут напрямую в кучу. Кэш потока освобождается при его завершении.
+class PoolAllocator : public MatrixAllocator {
+ public:
+  static constexpr std::size_t kMaxPooledBytes = std::size_t{32} << 20;
+  static constexpr std::size_t kMaxCachedBytes = std::size_t{64} << 20;
+
+  static PoolAllocator &Instance();
+
+  void *Allocate(std::size_t bytes) override;
+  void Deallocate(void *block, std::size_t bytes) override;
+  AllocatorStats GetStats() const override;
+  // Возвращает в кучу блоки из кэша вызывающего потока.
+  void Trim();
+
+ private:
+  PoolAllocator() = default;
+
+  std::atomic<std::size_t> allocations_{0};
+  std::atomic<std::size_t> deallocations_{0};
+  std::atomic<std::size_t> reused_{0};
+  std::atomic<std::size_t> heap_allocations_{0};
+  std::atomic<std::size_t> bytes_in_use_{0};
+  std::atomic<std::size_t> bytes_cached_{0};
+};
+
+// Аллокатор для новых матриц во всех потоках. По умолчанию —
+// HeapAllocator; переменная окружения S21_ALLOCATOR=pool выбирает
+// PoolAllocator при загрузке. Возвращает предыдущий аллокатор.
+MatrixAllocator &GetMatrixAllocator();
+MatrixAllocator &SetMatrixAllocator(MatrixAllocator &allocator);
+
+}  // namespace s21
+
+#endif
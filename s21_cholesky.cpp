@@ -0,0 +1,185 @@
+#include "s21_cholesky.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include "s21_gemm.h"
+
+namespace s21 {
+
+namespace {
+
+// Ширина панели, как у LU: столбцы панели раскладываются по одному,
+// остаток матрицы обновляется вызовами Gemm.
+constexpr int kPanel = 64;
+// Высота полосы строк в обновлении остатка: выше полоса — меньше вызовов
+// Gemm, но больше лишней работы над диагональю.
+constexpr int kUpdateRows = 256;
+
+double *Row(double *a, int lda, int i) {
+  return a + static_cast<std::size_t>(i) * lda;
+}
+
+const double *Row(const double *a, int lda, int i) {
+  return a + static_cast<std::size_t>(i) * lda;
+}
+
+// Раскладывает столбцы [j0, j1) на строках [j0, n); предыдущие панели
+// уже вычтены из этих столбцов. Строки обходятся по порядку, и каждый
+// элемент — скалярное произведение двух непрерывных кусков строк.
+int FactorPanel(int n, int j0, int j1, double *a, int lda) {
+  int info = 0;
+  for (int r = j0; r < n && info == 0; r++) {
+    double *row = Row(a, lda, r);
+    for (int c = j0; c < std::min(j1, r + 1) && info == 0; c++) {
+      const double *top = Row(a, lda, c);
+      double sum = row[c];
+      for (int p = j0; p < c; p++) {
+        sum -= row[p] * top[p];
+      }
+      if (r > c) {
+        row[c] = sum / top[c];
+      } else if (sum > 0.0) {
+        row[c] = std::sqrt(sum);
+      } else {
+        info = c + 1;
+      }
+    }
+  }
+  return info;
+}
+
+}  // namespace
+
+// A22 -= L21 * L21^T считается только для нижнего треугольника: по
+// полосам строк, каждая до своего диагонального блока включительно.
+int CholeskyFactor(int n, double *a, int lda) {
+  int info = 0;
+  for (int j0 = 0; j0 < n && info == 0; j0 += kPanel) {
+    const int j1 = std::min(n, j0 + kPanel);
+    info = FactorPanel(n, j0, j1, a, lda);
+    for (int r0 = j1; r0 < n && info == 0; r0 += kUpdateRows) {
+      const int r1 = std::min(n, r0 + kUpdateRows);
+      Gemm(Trans::kNo, Trans::kYes, r1 - r0, r1 - j1, j1 - j0, -1.0,
+           Row(a, lda, r0) + j0, lda, Row(a, lda, j1) + j0, lda, 1.0,
+           Row(a, lda, r0) + j1, lda);
+    }
+  }
+  return info;
+}
+
+void CholeskySolve(int n, const double *l, int ldl, int nrhs, double *b,
+                   int ldb) {
+  // L Y = B: блок строк обновляется найденными строками через Gemm, затем
+  // досчитывается подстановкой внутри блока.
+  for (int i0 = 0; i0 < n; i0 += kPanel) {
+    const int i1 = std::min(n, i0 + kPanel);
+    if (i0 > 0) {
+      Gemm(i1 - i0, nrhs, i0, -1.0, Row(l, ldl, i0), ldl, b, ldb, 1.0,
+           Row(b, ldb, i0), ldb);
+    }
+    for (int i = i0; i < i1; i++) {
+      double *row = Row(b, ldb, i);
+      const double *li = Row(l, ldl, i);
+      for (int p = i0; p < i; p++) {
+        const double *src = Row(b, ldb, p);
+        for (int j = 0; j < nrhs; j++) {
+          row[j] -= li[p] * src[j];
+        }
+      }
+      const double inv = 1.0 / li[i];
+      for (int j = 0; j < nrhs; j++) {
+        row[j] *= inv;
+      }
+    }
+  }
+  // L^T X = Y: блоки снизу вверх, L^T берётся транспонированием в Gemm.
+  for (int i1 = n; i1 > 0; i1 -= kPanel) {
+    const int i0 = std::max(0, i1 - kPanel);
+    if (i1 < n) {
+      Gemm(Trans::kYes, Trans::kNo, i1 - i0, nrhs, n - i1, -1.0,
+           Row(l, ldl, i1) + i0, ldl, Row(b, ldb, i1), ldb, 1.0,
+           Row(b, ldb, i0), ldb);
+    }
+    for (int i = i1 - 1; i >= i0; i--) {
+      double *row = Row(b, ldb, i);
+      for (int p = i + 1; p < i1; p++) {
+        const double lpi = Row(l, ldl, p)[i];
+        const double *src = Row(b, ldb, p);
+        for (int j = 0; j < nrhs; j++) {
+          row[j] -= lpi * src[j];
+        }
+      }
+      const double inv = 1.0 / Row(l, ldl, i)[i];
+      for (int j = 0; j < nrhs; j++) {
+        row[j] *= inv;
+      }
+    }
+  }
+}
+
+}  // namespace s21
+
+S21Cholesky::S21Cholesky(const S21MatrixView &matrix)
+    : factor_(matrix.ToMatrix()) {
+  Factor();
+}
+
+S21Cholesky::S21Cholesky(S21Matrix &&matrix) : factor_(std::move(matrix)) {
+  if (factor_.Data() == nullptr) {
+    throw std::runtime_error("Matrix not initialized");
+  }
+  Factor();
+}
+
+void S21Cholesky::Factor() {
+  const int n = factor_.GetRows();
+  if (n != factor_.GetCols()) {
+    throw std::invalid_argument("Matrix must be square");
+  }
+  if (s21::CholeskyFactor(n, factor_.Data(), factor_.GetStride()) != 0) {
+    throw std::runtime_error("Matrix is not positive definite");
+  }
+  for (int i = 0; i < n; i++) {
+    std::fill(factor_.Row(i).begin() + i + 1, factor_.Row(i).end(), 0.0);
+  }
+}
+
+bool S21Cholesky::IsPositiveDefinite(const S21MatrixView &matrix) {
+  if (matrix.GetRows() != matrix.GetCols()) {
+    throw std::invalid_argument("Matrix must be square");
+  }
+  S21Matrix work = matrix.ToMatrix();
+  return s21::CholeskyFactor(work.GetRows(), work.Data(), work.GetStride()) ==
+         0;
+}
+
+S21Matrix S21Cholesky::Solve(const S21MatrixView &b) const {
+  if (b.GetRows() != factor_.GetRows()) {
+    throw std::invalid_argument("Invalid dimensions for solve");
+  }
+  S21Matrix result = b.ToMatrix();
+  s21::CholeskySolve(factor_.GetRows(), factor_.Data(), factor_.GetStride(),
+                     result.GetCols(), result.Data(), result.GetStride());
+  return result;
+}
+
+double S21Cholesky::Determinant() const {
+  double result = 1.0;
+  for (int i = 0; i < factor_.GetRows(); i++) {
+    result *= factor_.At(i, i) * factor_.At(i, i);
+  }
+  return result;
+}
+
+S21Matrix S21Cholesky::InverseMatrix() const {
+  const int n = factor_.GetRows();
+  S21Matrix result(n, n, factor_.GetLayout());
+  for (int i = 0; i < n; i++) {
+    result.At(i, i) = 1.0;
+  }
+  s21::CholeskySolve(n, factor_.Data(), factor_.GetStride(), n, result.Data(),
+                     result.GetStride());
+  return result;
+}
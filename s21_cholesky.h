@@ -0,0 +1,51 @@
+#ifndef S21_CHOLESKY_H
+#define S21_CHOLESKY_H
+
+#include "s21_matrix_oop.h"
+
+namespace s21 {
+
+// Факторизация A = L L^T на месте для симметричной положительно
+// определённой row-major матрицы n x n с шагом строк lda. Читается только
+// нижний треугольник A; после вызова на диагонали и ниже лежит L, а
+// элементы выше диагонали не определены.
+// Возвращает 0 при успехе, иначе k + 1, где k — первая строка, на которой
+// ведущий минор оказался не положительным (факторизация прерывается).
+int CholeskyFactor(int n, double *a, int lda);
+
+// Решает A X = B по результату CholeskyFactor: B — row-major n x nrhs с
+// шагом ldb, перезаписывается решением X.
+void CholeskySolve(int n, const double *l, int ldl, int nrhs, double *b,
+                   int ldb);
+
+}  // namespace s21
+
+// Разложение Холецкого симметричной положительно определённой матрицы:
+// вдвое меньше операций, чем у LU, и без выбора ведущего элемента.
+// Используется только нижний треугольник исходной матрицы. Конструктор
+// бросает std::runtime_error, если матрица не положительно определена.
+class S21Cholesky {
+ public:
+  explicit S21Cholesky(const S21MatrixView &matrix);
+  // Раскладывает матрицу в её же буфере, без копии.
+  explicit S21Cholesky(S21Matrix &&matrix);
+
+  // Проверка разложением на копии; исключений не бросает, кроме
+  // ошибок размеров.
+  static bool IsPositiveDefinite(const S21MatrixView &matrix);
+
+  // Нижнетреугольный множитель L (над диагональю нули).
+  const S21Matrix &GetL() const noexcept { return factor_; }
+  // X из A X = B, B — n x k.
+  S21Matrix Solve(const S21MatrixView &b) const;
+  // det(A) = prod(L_ii)^2.
+  double Determinant() const;
+  S21Matrix InverseMatrix() const;
+
+ private:
+  void Factor();
+
+  S21Matrix factor_;
+};
+
+#endif
@@ -0,0 +1,344 @@
+#ifndef S21_FIXED_MATRIX_H
+#define S21_FIXED_MATRIX_H
+
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_matrix_oop.h"
+
+// Матрица с размерами, известными на этапе компиляции. Элементы хранятся
+// внутри объекта (без кучи), проверки размеров выполняет компилятор, а
+// Determinant, Transpose, InverseMatrix и умножение доступны в constexpr.
+// Интерфейс повторяет S21Matrix; поэлементные операции не проверяют
+// значения на NaN/бесконечность.
+template <int Rows, int Cols>
+class S21FixedMatrix {
+  static_assert(Rows > 0 && Cols > 0, "Rows and columns must be >0");
+
+  template <int, int>
+  friend class S21FixedMatrix;
+
+ public:
+  constexpr S21FixedMatrix() : matrix_{} {}
+
+  // Значения построчно; их число должно быть Rows * Cols.
+  constexpr S21FixedMatrix(std::initializer_list<double> values) : matrix_{} {
+    if (values.size() != static_cast<std::size_t>(Rows * Cols)) {
+      throw std::invalid_argument("Invalid number of values");
+    }
+    int k = 0;
+    for (double value : values) {
+      matrix_[k / Cols][k % Cols] = value;
+      k++;
+    }
+  }
+
+  explicit S21FixedMatrix(const S21Matrix &other) : matrix_{} {
+    if (other.getMatrix() == nullptr) {
+      throw std::runtime_error("Matrix not initialized");
+    }
+    if (other.GetRows() != Rows || other.GetCols() != Cols) {
+      throw std::invalid_argument("Matrices must have the same dimensions");
+    }
+    for (int i = 0; i < Rows; i++) {
+      for (int j = 0; j < Cols; j++) {
+        matrix_[i][j] = other.getMatrix()[i][j];
+      }
+    }
+  }
+
+  S21Matrix ToS21Matrix() const {
+    S21Matrix result(Rows, Cols);
+    for (int i = 0; i < Rows; i++) {
+      for (int j = 0; j < Cols; j++) {
+        result.getMatrix()[i][j] = matrix_[i][j];
+      }
+    }
+    return result;
+  }
+
+  static constexpr int GetRows() { return Rows; }
+  static constexpr int GetCols() { return Cols; }
+
+  constexpr double &operator()(int i, int j) {
+    CheckIndex(i, j);
+    return matrix_[i][j];
+  }
+  constexpr const double &operator()(int i, int j) const {
+    CheckIndex(i, j);
+    return matrix_[i][j];
+  }
+
+  // Как S21Matrix::EqMatrix с kDefaultTolerance: NaN в разности не
+  // считается расхождением.
+  constexpr bool EqMatrix(const S21FixedMatrix &other) const {
+    bool result = true;
+    for (int i = 0; i < Rows && result; i++) {
+      for (int j = 0; j < Cols && result; j++) {
+        result = !(Abs(matrix_[i][j] - other.matrix_[i][j]) >
+                   S21Matrix::kDefaultTolerance.value);
+      }
+    }
+    return result;
+  }
+
+  constexpr void SumMatrix(const S21FixedMatrix &other) {
+    for (int i = 0; i < Rows; i++) {
+      for (int j = 0; j < Cols; j++) {
+        matrix_[i][j] += other.matrix_[i][j];
+      }
+    }
+  }
+
+  constexpr void SubMatrix(const S21FixedMatrix &other) {
+    for (int i = 0; i < Rows; i++) {
+      for (int j = 0; j < Cols; j++) {
+        matrix_[i][j] -= other.matrix_[i][j];
+      }
+    }
+  }
+
+  constexpr void MulNumber(const double num) {
+    if (!(Abs(num) <= std::numeric_limits<double>::max())) {
+      throw std::invalid_argument("Number must be finite");
+    }
+    for (int i = 0; i < Rows; i++) {
+      for (int j = 0; j < Cols; j++) {
+        matrix_[i][j] *= num;
+      }
+    }
+  }
+
+  // Размер результата не меняется, поэтому other обязана быть Cols x Cols.
+  constexpr void MulMatrix(const S21FixedMatrix<Cols, Cols> &other) {
+    *this = *this * other;
+  }
+
+  constexpr S21FixedMatrix<Cols, Rows> Transpose() const {
+    S21FixedMatrix<Cols, Rows> result;
+    for (int i = 0; i < Rows; i++) {
+      for (int j = 0; j < Cols; j++) {
+        result.matrix_[j][i] = matrix_[i][j];
+      }
+    }
+    return result;
+  }
+
+  constexpr double Determinant() const {
+    static_assert(Rows == Cols, "Matrix must be square");
+    double result = 0.0;
+    if constexpr (Rows == 1) {
+      result = matrix_[0][0];
+    } else if constexpr (Rows == 2) {
+      result = matrix_[0][0] * matrix_[1][1] - matrix_[1][0] * matrix_[0][1];
+    } else if constexpr (Rows == 3) {
+      result = matrix_[0][0] * Cofactor2(1, 2, 1, 2) -
+               matrix_[0][1] * Cofactor2(1, 2, 0, 2) +
+               matrix_[0][2] * Cofactor2(1, 2, 0, 1);
+    } else {
+      // Гаусс с выбором ведущего элемента по столбцу на копии.
+      S21FixedMatrix lu(*this);
+      result = 1.0;
+      for (int c = 0; c < Rows && result != 0.0; c++) {
+        const int pivot = lu.PivotRow(c);
+        if (pivot != c) {
+          lu.SwapRows(c, pivot);
+          result = -result;
+        }
+        result *= lu.matrix_[c][c];
+        lu.EliminateBelow(c);
+      }
+    }
+    return result;
+  }
+
+  // Как у S21Matrix: минор матрицы 1x1 пуст, поэтому для неё
+  // std::invalid_argument (и вызов не является константным выражением).
+  constexpr S21FixedMatrix CalcComplements() const {
+    static_assert(Rows == Cols, "Matrix must be square");
+    S21FixedMatrix result;
+    if constexpr (Rows == 1) {
+      throw std::invalid_argument("Rows and columns must be >0");
+    } else {
+      for (int i = 0; i < Rows; i++) {
+        for (int j = 0; j < Cols; j++) {
+          const double det = GetMinor(i, j).Determinant();
+          result.matrix_[i][j] = (i + j) % 2 == 0 ? det : -det;
+        }
+      }
+    }
+    return result;
+  }
+
+  constexpr S21FixedMatrix InverseMatrix() const {
+    static_assert(Rows == Cols, "Matrix must be square");
+    S21FixedMatrix result;
+    if constexpr (Rows <= 3) {
+      const double det = Determinant();
+      if (det == 0.0) {
+        throw std::runtime_error("Matrix is singular");
+      }
+      if constexpr (Rows == 1) {
+        result.matrix_[0][0] = 1.0 / det;
+      } else {
+        result = CalcComplements().Transpose();
+        result.MulNumber(1.0 / det);
+      }
+    } else {
+      // Гаусс-Жордан: [A | I] -> [I | A^-1].
+      S21FixedMatrix work(*this);
+      for (int i = 0; i < Rows; i++) {
+        result.matrix_[i][i] = 1.0;
+      }
+      for (int c = 0; c < Rows; c++) {
+        const int pivot = work.PivotRow(c);
+        if (work.matrix_[pivot][c] == 0.0) {
+          throw std::runtime_error("Matrix is singular");
+        }
+        work.SwapRows(c, pivot);
+        result.SwapRows(c, pivot);
+        const double inv = 1.0 / work.matrix_[c][c];
+        for (int j = 0; j < Cols; j++) {
+          work.matrix_[c][j] *= inv;
+          result.matrix_[c][j] *= inv;
+        }
+        for (int r = 0; r < Rows; r++) {
+          const double factor = work.matrix_[r][c];
+          if (r != c && factor != 0.0) {
+            for (int j = 0; j < Cols; j++) {
+              work.matrix_[r][j] -= factor * work.matrix_[c][j];
+              result.matrix_[r][j] -= factor * result.matrix_[c][j];
+            }
+          }
+        }
+      }
+    }
+    return result;
+  }
+
+  constexpr S21FixedMatrix<Rows - 1, Cols - 1> GetMinor(
+      int excluded_row, int excluded_col) const {
+    S21FixedMatrix<Rows - 1, Cols - 1> minor;
+    for (int i = 0, mi = 0; i < Rows; i++) {
+      if (i != excluded_row) {
+        for (int j = 0, mj = 0; j < Cols; j++) {
+          if (j != excluded_col) minor.matrix_[mi][mj++] = matrix_[i][j];
+        }
+        mi++;
+      }
+    }
+    return minor;
+  }
+
+  constexpr S21FixedMatrix operator+(const S21FixedMatrix &other) const {
+    S21FixedMatrix result(*this);
+    result.SumMatrix(other);
+    return result;
+  }
+  constexpr S21FixedMatrix operator-(const S21FixedMatrix &other) const {
+    S21FixedMatrix result(*this);
+    result.SubMatrix(other);
+    return result;
+  }
+  constexpr S21FixedMatrix operator*(const double num) const {
+    S21FixedMatrix result(*this);
+    result.MulNumber(num);
+    return result;
+  }
+
+  // Полностью развёрнутое произведение: каждый элемент результата —
+  // свёртка fold-выражением по индексам, известным при компиляции.
+  template <int Other>
+  constexpr S21FixedMatrix<Rows, Other> operator*(
+      const S21FixedMatrix<Cols, Other> &other) const {
+    S21FixedMatrix<Rows, Other> result;
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+      ((result.matrix_[I / Other][I % Other] =
+            Dot<I / Other, I % Other>(other, std::make_index_sequence<Cols>())),
+       ...);
+    }(std::make_index_sequence<Rows * Other>());
+    return result;
+  }
+
+  constexpr bool operator==(const S21FixedMatrix &other) const {
+    return EqMatrix(other);
+  }
+  constexpr S21FixedMatrix &operator+=(const S21FixedMatrix &other) {
+    SumMatrix(other);
+    return *this;
+  }
+  constexpr S21FixedMatrix &operator-=(const S21FixedMatrix &other) {
+    SubMatrix(other);
+    return *this;
+  }
+  constexpr S21FixedMatrix &operator*=(const double num) {
+    MulNumber(num);
+    return *this;
+  }
+  constexpr S21FixedMatrix &operator*=(
+      const S21FixedMatrix<Cols, Cols> &other) {
+    MulMatrix(other);
+    return *this;
+  }
+
+ private:
+  double matrix_[Rows][Cols];
+
+  static constexpr double Abs(double value) {
+    return value < 0.0 ? -value : value;
+  }
+
+  constexpr void CheckIndex(int i, int j) const {
+    if (i < 0 || i >= Rows || j < 0 || j >= Cols) {
+      throw std::out_of_range("Index out of bounds");
+    }
+  }
+
+  template <std::size_t Row, std::size_t Col, int Other, std::size_t... P>
+  constexpr double Dot(const S21FixedMatrix<Cols, Other> &other,
+                       std::index_sequence<P...>) const {
+    return ((matrix_[Row][P] * other.matrix_[P][Col]) + ...);
+  }
+
+  constexpr double Cofactor2(int r0, int r1, int c0, int c1) const {
+    return matrix_[r0][c0] * matrix_[r1][c1] -
+           matrix_[r0][c1] * matrix_[r1][c0];
+  }
+
+  constexpr int PivotRow(int c) const {
+    int pivot = c;
+    for (int r = c + 1; r < Rows; r++) {
+      if (Abs(matrix_[r][c]) > Abs(matrix_[pivot][c])) pivot = r;
+    }
+    return pivot;
+  }
+
+  constexpr void SwapRows(int a, int b) {
+    for (int j = 0; j < Cols && a != b; j++) {
+      const double tmp = matrix_[a][j];
+      matrix_[a][j] = matrix_[b][j];
+      matrix_[b][j] = tmp;
+    }
+  }
+
+  constexpr void EliminateBelow(int c) {
+    for (int r = c + 1; r < Rows && matrix_[c][c] != 0.0; r++) {
+      const double factor = matrix_[r][c] / matrix_[c][c];
+      for (int j = c; j < Cols; j++) {
+        matrix_[r][j] -= factor * matrix_[c][j];
+      }
+    }
+  }
+};
+
+template <int Rows, int Cols>
+constexpr S21FixedMatrix<Rows, Cols> operator*(
+    const double num, const S21FixedMatrix<Rows, Cols> &matrix) {
+  return matrix * num;
+}
+
+#endif
@@ -0,0 +1,262 @@
+#include "s21_gemm.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "s21_simd.h"
+#include "s21_thread_pool.h"
+
+namespace s21 {
+
+namespace {
+
+// Размеры блоков подобраны под типичные L1/L2/L3: панель A (kMc x kKc)
+// живёт в L2, панель B (kKc x kNc) — в L3, микропанель B (kKc x kNr) — в L1.
+constexpr int kMr = 4;
+constexpr int kNr = 8;
+constexpr int kMc = 128;
+constexpr int kKc = 256;
+constexpr int kNc = 4096;
+// Ниже этого объёма работы упаковка дороже, чем выигрыш от блочности.
+constexpr long long kSmallWork = 32LL * 32 * 32;
+// Ширина плитки C по столбцам для одной задачи пула (кратна kNr).
+constexpr int kTileCols = 256;
+// Ниже этого объёма работы запуск задач в пуле не окупается.
+constexpr long long kParallelWork = 128LL * 128 * 128;
+// То же для GEMV, где на элемент A приходится одно умножение.
+constexpr long long kGemvParallelWork = 256LL * 1024;
+// Ширина полосы y в транспонированном GEMV: полоса остаётся в L1, пока
+// к ней прибавляются все строки A.
+constexpr int kGemvCols = 1024;
+
+// Операнд с шагами по строкам и столбцам: op(X)(i, j) = data[i * rs +
+// j * cs]. Транспонирование — это просто обмен шагов.
+struct Operand {
+  const double *data;
+  std::size_t rs, cs;
+
+  Operand(Trans trans, const double *x, int ld)
+      : data(x),
+        rs(trans == Trans::kNo ? ld : 1),
+        cs(trans == Trans::kNo ? 1 : ld) {}
+  Operand(const double *x, std::size_t row_step, std::size_t col_step)
+      : data(x), rs(row_step), cs(col_step) {}
+  const double *At(int i, int j) const {
+    return data + static_cast<std::size_t>(i) * rs +
+           static_cast<std::size_t>(j) * cs;
+  }
+};
+
+// Копирует блок A (mc x kc) в панели по kMr строк: внутри панели элементы
+// идут столбец за столбцом, недостающие строки дополняются нулями.
+void PackA(int mc, int kc, const Operand &a, double *packed) {
+  for (int ir = 0; ir < mc; ir += kMr) {
+    const int mr = std::min(kMr, mc - ir);
+    for (int p = 0; p < kc; p++) {
+      for (int i = 0; i < mr; i++) {
+        packed[i] = *a.At(ir + i, p);
+      }
+      for (int i = mr; i < kMr; i++) {
+        packed[i] = 0.0;
+      }
+      packed += kMr;
+    }
+  }
+}
+
+// Копирует блок B (kc x nc) в панели по kNr столбцов: внутри панели
+// строки по kNr элементов идут подряд, недостающие столбцы — нули.
+void PackB(int kc, int nc, const Operand &b, double *packed) {
+  for (int jr = 0; jr < nc; jr += kNr) {
+    const int nr = std::min(kNr, nc - jr);
+    for (int p = 0; p < kc; p++) {
+      const double *row = b.At(p, jr);
+      for (int j = 0; j < nr; j++) {
+        packed[j] = row[j * b.cs];
+      }
+      for (int j = nr; j < kNr; j++) {
+        packed[j] = 0.0;
+      }
+      packed += kNr;
+    }
+  }
+}
+
+// Регистровый блок kMr x kNr: аккумуляторы остаются в регистрах всё
+// время прохода по kc, а внутренний цикл по j векторизуется компилятором.
+void MicroKernel(int kc, const double *a, const double *b,
+                 double acc[kMr][kNr]) {
+  double c[kMr][kNr] = {};
+  for (int p = 0; p < kc; p++) {
+    for (int i = 0; i < kMr; i++) {
+      const double ai = a[i];
+      for (int j = 0; j < kNr; j++) {
+        c[i][j] += ai * b[j];
+      }
+    }
+    a += kMr;
+    b += kNr;
+  }
+  for (int i = 0; i < kMr; i++) {
+    for (int j = 0; j < kNr; j++) {
+      acc[i][j] = c[i][j];
+    }
+  }
+}
+
+void StoreTile(int mr, int nr, double alpha, const double acc[kMr][kNr],
+               double beta, double *c, int ldc) {
+  for (int i = 0; i < mr; i++) {
+    double *row = c + static_cast<std::size_t>(i) * ldc;
+    for (int j = 0; j < nr; j++) {
+      row[j] = beta == 0.0 ? alpha * acc[i][j]
+                           : alpha * acc[i][j] + beta * row[j];
+    }
+  }
+}
+
+void ScaleC(int m, int n, double beta, double *c, int ldc) {
+  for (int i = 0; i < m; i++) {
+    double *row = c + static_cast<std::size_t>(i) * ldc;
+    for (int j = 0; j < n; j++) {
+      row[j] = beta == 0.0 ? 0.0 : beta * row[j];
+    }
+  }
+}
+
+void SmallGemm(int m, int n, int k, double alpha, const Operand &a,
+               const Operand &b, double beta, double *c, int ldc) {
+  ScaleC(m, n, beta, c, ldc);
+  for (int i = 0; i < m; i++) {
+    double *out = c + static_cast<std::size_t>(i) * ldc;
+    for (int p = 0; p < k; p++) {
+      const double aip = alpha * *a.At(i, p);
+      const double *row = b.At(p, 0);
+      for (int j = 0; j < n; j++) {
+        out[j] += aip * row[j * b.cs];
+      }
+    }
+  }
+}
+
+}  // namespace
+
+void Gemm(int m, int n, int k, double alpha, const double *a, int lda,
+          const double *b, int ldb, double beta, double *c, int ldc) {
+  Gemm(Trans::kNo, Trans::kNo, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+void Gemm(Trans trans_a, Trans trans_b, int m, int n, int k, double alpha,
+          const double *a_data, int lda, const double *b_data, int ldb,
+          double beta, double *c, int ldc) {
+  const Operand a(trans_a, a_data, lda);
+  const Operand b(trans_b, b_data, ldb);
+  if (m <= 0 || n <= 0) return;
+  if (k <= 0 || alpha == 0.0) {
+    ScaleC(m, n, beta, c, ldc);
+    return;
+  }
+  if (static_cast<long long>(m) * n * k <= kSmallWork) {
+    SmallGemm(m, n, k, alpha, a, b, beta, c, ldc);
+    return;
+  }
+
+  // Буфер упаковки B переиспользуется между вызовами в пределах потока.
+  thread_local std::vector<double> packed_b;
+  packed_b.resize(static_cast<std::size_t>(kKc) * (kNc + kNr));
+
+  ThreadPool &pool = ThreadPool::Instance();
+  const bool parallel = static_cast<long long>(m) * n * k >= kParallelWork &&
+                        pool.GetThreadCount() > 1;
+  for (int jc = 0; jc < n; jc += kNc) {
+    const int nc = std::min(kNc, n - jc);
+    for (int pc = 0; pc < k; pc += kKc) {
+      const int kc = std::min(kKc, k - pc);
+      // beta применяется только на первом проходе по k, дальше накапливаем.
+      const double beta_eff = pc == 0 ? beta : 1.0;
+      PackB(kc, nc, Operand(b.At(pc, jc), b.rs, b.cs), packed_b.data());
+      // Плитки C (kMc x kTileCols) не пересекаются и считаются независимо:
+      // каждая задача пакует свою панель A и читает общую упакованную B.
+      const int row_tiles = (m + kMc - 1) / kMc;
+      const int col_tiles = parallel ? (nc + kTileCols - 1) / kTileCols : 1;
+      const int tile_cols = parallel ? kTileCols : nc;
+      // thread_local не захватывается лямбдой: в задачах нужен указатель на
+      // буфер вызывающего потока.
+      const double *shared_b = packed_b.data();
+      auto tile = [&](int task) {
+        const int ic = task / col_tiles * kMc;
+        const int mc = std::min(kMc, m - ic);
+        const int j0 = task % col_tiles * tile_cols;
+        const int j1 = std::min(nc, j0 + tile_cols);
+        thread_local std::vector<double> packed_a;
+        packed_a.resize(static_cast<std::size_t>(kMc) * kKc);
+        PackA(mc, kc, Operand(a.At(ic, pc), a.rs, a.cs), packed_a.data());
+        double acc[kMr][kNr];
+        for (int jr = j0; jr < j1; jr += kNr) {
+          const int nr = std::min(kNr, j1 - jr);
+          const double *pb = shared_b + static_cast<std::size_t>(jr) * kc;
+          for (int ir = 0; ir < mc; ir += kMr) {
+            const int mr = std::min(kMr, mc - ir);
+            const double *pa =
+                packed_a.data() + static_cast<std::size_t>(ir) * kc;
+            MicroKernel(kc, pa, pb, acc);
+            StoreTile(mr, nr, alpha, acc, beta_eff,
+                      c + static_cast<std::size_t>(ic + ir) * ldc + jc + jr,
+                      ldc);
+          }
+        }
+      };
+      if (parallel) {
+        pool.ParallelFor(row_tiles * col_tiles, tile);
+      } else {
+        for (int task = 0; task < row_tiles; task++) tile(task);
+      }
+    }
+  }
+}
+
+// kNo: y_i — скалярное произведение строки A на x. kYes: y += (alpha *
+// x_i) * строка i, по полосам столбцов; и строки, и полосы независимы,
+// поэтому задачи пула не пересекаются по записи.
+void Gemv(Trans trans, int m, int n, double alpha, const double *a, int lda,
+          const double *x, double beta, double *y) {
+  const int out = trans == Trans::kNo ? m : n;
+  const auto scale_y = [beta, y](int first, int last) {
+    for (int i = first; i < last; i++) y[i] = beta == 0.0 ? 0.0 : beta * y[i];
+  };
+  const auto rows = [&](int first, int last) {
+    if (alpha == 0.0) scale_y(first, last);
+    for (int i = first; i < last && alpha != 0.0; i++) {
+      const double dot = simd::Dot(a + static_cast<std::size_t>(i) * lda, x, n);
+      y[i] = alpha * dot + (beta == 0.0 ? 0.0 : beta * y[i]);
+    }
+  };
+  const auto cols = [&](int first, int last) {
+    scale_y(first, last);
+    for (int i = 0; i < m && alpha != 0.0; i++) {
+      simd::AddScaled(y + first, a + static_cast<std::size_t>(i) * lda + first,
+                      alpha * x[i], last - first);
+    }
+  };
+  const int chunk = trans == Trans::kNo ? kMc : kGemvCols;
+  const int tasks = (out + chunk - 1) / chunk;
+  const auto task = [&](int t) {
+    const int first = t * chunk;
+    const int last = std::min(out, first + chunk);
+    if (trans == Trans::kNo) {
+      rows(first, last);
+    } else {
+      cols(first, last);
+    }
+  };
+  ThreadPool &pool = ThreadPool::Instance();
+  if (static_cast<long long>(m) * n >= kGemvParallelWork && tasks > 1 &&
+      pool.GetThreadCount() > 1) {
+    pool.ParallelFor(tasks, task);
+  } else {
+    for (int t = 0; t < tasks; t++) task(t);
+  }
+}
+
+}  // namespace s21
@@ -0,0 +1,35 @@
+#ifndef S21_GEMM_H
+#define S21_GEMM_H
+
+namespace s21 {
+
+// Использовать операнд как есть или транспонированным.
+enum class Trans { kNo, kYes };
+
+// C = alpha * A * B + beta * C для row-major матриц с произвольным шагом
+// строк: A — m x k (lda), B — k x n (ldb), C — m x n (ldc).
+// При beta == 0 исходное содержимое C не читается.
+void Gemm(int m, int n, int k, double alpha, const double *a, int lda,
+          const double *b, int ldb, double beta, double *c, int ldc);
+
+// C = alpha * op(A) * op(B) + beta * C, где op(X) = X или X^T по флагу.
+// op(A) — m x k, op(B) — k x n; lda и ldb — шаги строк хранимых A и B
+// (для kYes хранится k x m и n x k соответственно). Транспонирование
+// выполняется при упаковке панелей, отдельной копии операнда нет.
+void Gemm(Trans trans_a, Trans trans_b, int m, int n, int k, double alpha,
+          const double *a, int lda, const double *b, int ldb, double beta,
+          double *c, int ldc);
+
+// y = alpha * op(A) * x + beta * y для row-major A m x n с шагом lda:
+// при kNo x — n элементов, y — m; при kYes x — m, y — n. При beta == 0
+// исходное содержимое y не читается, при alpha == 0 не читаются A и x
+// (y только масштабируется, как в BLAS); x и y не должны пересекаться.
+// Каждый элемент A читается один раз, так что скорость ограничена
+// пропускной способностью памяти; крупные произведения делятся между
+// потоками пула.
+void Gemv(Trans trans, int m, int n, double alpha, const double *a, int lda,
+          const double *x, double beta, double *y);
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,259 @@
+#include "s21_lu.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "s21_gemm.h"
+
+namespace s21 {
+
+namespace {
+
+// Ширина панели: столбцы панели раскладываются по одному, остаток
+// матрицы обновляется одним вызовом Gemm на панель.
+constexpr int kPanel = 64;
+
+double *Row(double *a, int lda, int i) {
+  return a + static_cast<std::size_t>(i) * lda;
+}
+
+const double *Row(const double *a, int lda, int i) {
+  return a + static_cast<std::size_t>(i) * lda;
+}
+
+void SwapRows(double *a, int lda, int n, int i, int j) {
+  std::swap_ranges(Row(a, lda, i), Row(a, lda, i) + n, Row(a, lda, j));
+}
+
+// Скалярное произведение в четыре независимых суммы, чтобы сложения не
+// ждали друг друга.
+double Dot(const double *a, const double *b, int n) {
+  double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+  int k = 0;
+  for (; k + 4 <= n; k += 4) {
+    s0 += a[k] * b[k];
+    s1 += a[k + 1] * b[k + 1];
+    s2 += a[k + 2] * b[k + 2];
+    s3 += a[k + 3] * b[k + 3];
+  }
+  for (; k < n; k++) s0 += a[k] * b[k];
+  return (s0 + s1) + (s2 + s3);
+}
+
+// Одна правая часть: подстановки скалярными произведениями строк LU с
+// непрерывной копией столбца; Gemm с одним столбцом упирается в упаковку.
+void SolveVector(int n, const double *lu, int ldlu, const int *pivots,
+                 double *b, int ldb) {
+  std::vector<double> x(n);
+  for (int i = 0; i < n; i++) x[i] = *Row(b, ldb, i);
+  for (int i = 0; i < n; i++) {
+    if (pivots[i] != i) std::swap(x[i], x[pivots[i]]);
+  }
+  for (int i = 1; i < n; i++) {
+    x[i] -= Dot(Row(lu, ldlu, i), x.data(), i);
+  }
+  for (int i = n - 1; i >= 0; i--) {
+    const double *u = Row(lu, ldlu, i);
+    x[i] = (x[i] - Dot(u + i + 1, x.data() + i + 1, n - i - 1)) / u[i];
+  }
+  for (int i = 0; i < n; i++) *Row(b, ldb, i) = x[i];
+}
+
+// Раскладывает столбцы [j0, j1) на строках [j0, n); строки переставляются
+// целиком, поэтому отдельный проход перестановок не нужен. Ведущий элемент
+// не больше tolerance по модулю считается нулевым, и столбец пропускается.
+int FactorPanel(int n, int j0, int j1, double *a, int lda, double tolerance,
+                int *pivots, int *swaps) {
+  int info = 0;
+  for (int c = j0; c < j1; c++) {
+    int pivot = c;
+    double best = std::abs(Row(a, lda, c)[c]);
+    for (int r = c + 1; r < n; r++) {
+      const double value = std::abs(Row(a, lda, r)[c]);
+      if (value > best) {
+        best = value;
+        pivot = r;
+      }
+    }
+    if (pivots != nullptr) pivots[c] = pivot;
+    if (pivot != c) {
+      SwapRows(a, lda, n, c, pivot);
+      if (swaps != nullptr) ++*swaps;
+    }
+    const double *top = Row(a, lda, c);
+    if (std::abs(top[c]) <= tolerance) {
+      if (info == 0) info = c + 1;
+      continue;
+    }
+    const double inv = 1.0 / top[c];
+    for (int r = c + 1; r < n; r++) {
+      double *row = Row(a, lda, r);
+      const double l = row[c] *= inv;
+      for (int j = c + 1; j < j1; j++) {
+        row[j] -= l * top[j];
+      }
+    }
+  }
+  return info;
+}
+
+}  // namespace
+
+// Порог вырожденности относителен, как у ранга в QR: после округления
+// ведущий элемент вырожденной матрицы обычно не точный ноль, а величина
+// порядка eps * max|a_ij|.
+int LuFactor(int n, double *a, int lda, int *pivots, int *swaps) {
+  int info = 0;
+  if (swaps != nullptr) *swaps = 0;
+  double largest = 0.0;
+  for (int i = 0; i < n; i++) {
+    const double *row = Row(a, lda, i);
+    for (int j = 0; j < n; j++) largest = std::max(largest, std::abs(row[j]));
+  }
+  const double tolerance =
+      n * std::numeric_limits<double>::epsilon() * largest;
+  for (int j0 = 0; j0 < n; j0 += kPanel) {
+    const int j1 = std::min(n, j0 + kPanel);
+    const int panel_info =
+        FactorPanel(n, j0, j1, a, lda, tolerance, pivots, swaps);
+    if (info == 0) info = panel_info;
+    if (j1 == n) break;
+    // U12 = L11^-1 * A12 (прямая подстановка по строкам панели).
+    for (int r = j0 + 1; r < j1; r++) {
+      double *row = Row(a, lda, r);
+      for (int p = j0; p < r; p++) {
+        const double l = row[p];
+        const double *src = Row(a, lda, p);
+        for (int j = j1; j < n; j++) {
+          row[j] -= l * src[j];
+        }
+      }
+    }
+    // A22 -= L21 * U12.
+    Gemm(n - j1, n - j1, j1 - j0, -1.0, Row(a, lda, j1) + j0, lda,
+         Row(a, lda, j0) + j1, lda, 1.0, Row(a, lda, j1) + j1, lda);
+  }
+  return info;
+}
+
+void LuSolve(int n, const double *lu, int ldlu, const int *pivots, int nrhs,
+             double *b, int ldb) {
+  if (nrhs == 1) {
+    SolveVector(n, lu, ldlu, pivots, b, ldb);
+    return;
+  }
+  for (int i = 0; i < n; i++) {
+    if (pivots[i] != i) SwapRows(b, ldb, nrhs, i, pivots[i]);
+  }
+  // L Y = P B: блок строк сначала обновляется уже найденными строками
+  // через Gemm, затем досчитывается прямой подстановкой внутри блока.
+  for (int i0 = 0; i0 < n; i0 += kPanel) {
+    const int i1 = std::min(n, i0 + kPanel);
+    if (i0 > 0) {
+      Gemm(i1 - i0, nrhs, i0, -1.0, Row(lu, ldlu, i0), ldlu, b, ldb, 1.0,
+           Row(b, ldb, i0), ldb);
+    }
+    for (int i = i0 + 1; i < i1; i++) {
+      double *row = Row(b, ldb, i);
+      const double *l = Row(lu, ldlu, i);
+      for (int p = i0; p < i; p++) {
+        const double *src = Row(b, ldb, p);
+        for (int j = 0; j < nrhs; j++) {
+          row[j] -= l[p] * src[j];
+        }
+      }
+    }
+  }
+  // U X = Y: те же блоки снизу вверх.
+  for (int i1 = n; i1 > 0; i1 -= kPanel) {
+    const int i0 = std::max(0, i1 - kPanel);
+    if (i1 < n) {
+      Gemm(i1 - i0, nrhs, n - i1, -1.0, Row(lu, ldlu, i0) + i1, ldlu,
+           Row(b, ldb, i1), ldb, 1.0, Row(b, ldb, i0), ldb);
+    }
+    for (int i = i1 - 1; i >= i0; i--) {
+      double *row = Row(b, ldb, i);
+      const double *u = Row(lu, ldlu, i);
+      for (int p = i + 1; p < i1; p++) {
+        const double *src = Row(b, ldb, p);
+        for (int j = 0; j < nrhs; j++) {
+          row[j] -= u[p] * src[j];
+        }
+      }
+      const double inv = 1.0 / u[i];
+      for (int j = 0; j < nrhs; j++) {
+        row[j] *= inv;
+      }
+    }
+  }
+}
+
+}  // namespace s21
+
+S21Lu::S21Lu(const S21MatrixView &matrix) : factor_(matrix.ToMatrix()) {
+  Factor();
+}
+
+S21Lu::S21Lu(S21Matrix &&matrix) : factor_(std::move(matrix)) {
+  if (factor_.Data() == nullptr) {
+    throw std::runtime_error("Matrix not initialized");
+  }
+  Factor();
+}
+
+void S21Lu::Factor() {
+  const int n = factor_.GetRows();
+  if (n != factor_.GetCols()) {
+    throw std::invalid_argument("Matrix must be square");
+  }
+  pivots_.resize(n);
+  singular_ = s21::LuFactor(n, factor_.Data(), factor_.GetStride(),
+                            pivots_.data(), &swaps_) != 0;
+}
+
+void S21Lu::CheckSolvable(int rows) const {
+  if (rows != factor_.GetRows()) {
+    throw std::invalid_argument("Invalid dimensions for solve");
+  }
+  if (singular_) throw std::runtime_error("Matrix is singular");
+}
+
+S21Matrix S21Lu::Solve(const S21MatrixView &b) const {
+  CheckSolvable(b.GetRows());
+  S21Matrix result = b.ToMatrix();
+  SolveInPlace(result);
+  return result;
+}
+
+void S21Lu::SolveInPlace(S21Matrix &b) const {
+  if (b.Data() == nullptr) throw std::runtime_error("Matrix not initialized");
+  CheckSolvable(b.GetRows());
+  s21::LuSolve(factor_.GetRows(), factor_.Data(), factor_.GetStride(),
+               pivots_.data(), b.GetCols(), b.Data(), b.GetStride());
+}
+
+double S21Lu::Determinant() const {
+  double result = 0.0;
+  if (!singular_) {
+    result = swaps_ % 2 == 0 ? 1.0 : -1.0;
+    for (int i = 0; i < factor_.GetRows(); i++) {
+      result *= factor_.At(i, i);
+    }
+  }
+  return result;
+}
+
+S21Matrix S21Lu::InverseMatrix() const {
+  const int n = factor_.GetRows();
+  S21Matrix result(n, n, factor_.GetLayout());
+  for (int i = 0; i < n; i++) {
+    result.At(i, i) = 1.0;
+  }
+  SolveInPlace(result);
+  return result;
+}
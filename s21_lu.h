@@ -0,0 +1,63 @@
+#ifndef S21_LU_H
+#define S21_LU_H
+
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+namespace s21 {
+
+// Факторизация PA = LU на месте для квадратной row-major матрицы n x n с
+// шагом строк lda (частичный выбор ведущего элемента по столбцу).
+// После вызова под диагональю лежит L (единичная диагональ не хранится),
+// на диагонали и выше — U. pivots[i] — номер строки, переставленной с i-й
+// на шаге i (может быть nullptr), *swaps — число фактических перестановок
+// (может быть nullptr).
+// Возвращает 0, если все ведущие элементы по модулю больше
+// n * eps * max|a_ij|, иначе k + 1, где k — первый столбец с численно
+// нулевым ведущим элементом; факторизация при этом доводится до конца.
+int LuFactor(int n, double *a, int lda, int *pivots, int *swaps);
+
+// Решает A X = B по результату LuFactor, вернувшего 0:
+// B — row-major n x nrhs с шагом ldb, перезаписывается решением X.
+void LuSolve(int n, const double *lu, int ldlu, const int *pivots, int nrhs,
+             double *b, int ldb);
+
+}  // namespace s21
+
+// Разложение PA = LU квадратной матрицы, сохраняемое для повторных
+// решений: факторизация стоит O(n^3) один раз, каждый Solve — O(n^2) на
+// столбец правой части. Вырожденная матрица раскладывается без ошибки,
+// исключение бросают только операции, которым нужна обратимость.
+class S21Lu {
+ public:
+  explicit S21Lu(const S21MatrixView &matrix);
+  // Раскладывает матрицу в её же буфере, без копии.
+  explicit S21Lu(S21Matrix &&matrix);
+
+  bool IsSingular() const noexcept { return singular_; }
+  // L и U в одной матрице: под диагональю L (единицы диагонали не
+  // хранятся), на диагонали и выше U.
+  const S21Matrix &GetLu() const noexcept { return factor_; }
+  // Строка, переставленная с i-й на шаге i.
+  const std::vector<int> &GetPivots() const noexcept { return pivots_; }
+
+  // X из A X = B, B — n x k; бросает std::runtime_error для вырожденной A.
+  S21Matrix Solve(const S21MatrixView &b) const;
+  // Решение на месте: b перезаписывается X без выделения памяти.
+  void SolveInPlace(S21Matrix &b) const;
+  // (-1)^swaps * prod(U_ii); 0 для вырожденной матрицы.
+  double Determinant() const;
+  S21Matrix InverseMatrix() const;
+
+ private:
+  void Factor();
+  void CheckSolvable(int rows) const;
+
+  S21Matrix factor_;
+  std::vector<int> pivots_;
+  int swaps_ = 0;
+  bool singular_ = false;
+};
+
+#endif
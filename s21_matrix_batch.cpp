@@ -0,0 +1,319 @@
+#include "s21_matrix_batch.h"
+
+#include <stdexcept>
+
+#include "s21_simd.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define S21_BATCH_X86 1
+#endif
+
+namespace {
+
+using s21::BatchGroup;
+constexpr int kLanes = s21::kBatchLanes;
+
+// Тела ядер встраиваются в обёртки с атрибутом target, поэтому один и
+// тот же код компилируется под каждый набор инструкций. Внутренний цикл
+// всегда идёт по дорожкам: восемь независимых матриц без ветвлений.
+#define S21_BATCH_INLINE inline __attribute__((always_inline))
+
+template <int N>
+S21_BATCH_INLINE void MulBody(const BatchGroup<N> *a, const BatchGroup<N> *b,
+                              BatchGroup<N> *c, std::size_t count) {
+  for (std::size_t g = 0; g < count; g++) {
+    BatchGroup<N> out;
+    for (int i = 0; i < N; i++) {
+      for (int j = 0; j < N; j++) {
+        double *sum = out.e[i * N + j];
+        for (int l = 0; l < kLanes; l++) sum[l] = 0.0;
+        for (int k = 0; k < N; k++) {
+          const double *x = a[g].e[i * N + k];
+          const double *y = b[g].e[k * N + j];
+          for (int l = 0; l < kLanes; l++) sum[l] += x[l] * y[l];
+        }
+      }
+    }
+    c[g] = out;
+  }
+}
+
+// Определитель и присоединённая матрица (adj(A) = det(A) * A^-1) по
+// явным формулам: для 4x4 — через шесть миноров 2x2 верхних и шесть
+// нижних строк.
+template <int N>
+S21_BATCH_INLINE double AdjugateLane(const BatchGroup<N> &m, int l,
+                                     double *adj) {
+  const auto a = [&](int i, int j) { return m.e[i * N + j][l]; };
+  double det = 0.0;
+  if constexpr (N == 2) {
+    adj[0] = a(1, 1);
+    adj[1] = -a(0, 1);
+    adj[2] = -a(1, 0);
+    adj[3] = a(0, 0);
+    det = a(0, 0) * a(1, 1) - a(0, 1) * a(1, 0);
+  } else if constexpr (N == 3) {
+    adj[0] = a(1, 1) * a(2, 2) - a(1, 2) * a(2, 1);
+    adj[1] = a(0, 2) * a(2, 1) - a(0, 1) * a(2, 2);
+    adj[2] = a(0, 1) * a(1, 2) - a(0, 2) * a(1, 1);
+    adj[3] = a(1, 2) * a(2, 0) - a(1, 0) * a(2, 2);
+    adj[4] = a(0, 0) * a(2, 2) - a(0, 2) * a(2, 0);
+    adj[5] = a(0, 2) * a(1, 0) - a(0, 0) * a(1, 2);
+    adj[6] = a(1, 0) * a(2, 1) - a(1, 1) * a(2, 0);
+    adj[7] = a(0, 1) * a(2, 0) - a(0, 0) * a(2, 1);
+    adj[8] = a(0, 0) * a(1, 1) - a(0, 1) * a(1, 0);
+    det = a(0, 0) * adj[0] + a(0, 1) * adj[3] + a(0, 2) * adj[6];
+  } else {
+    const double s0 = a(0, 0) * a(1, 1) - a(1, 0) * a(0, 1);
+    const double s1 = a(0, 0) * a(1, 2) - a(1, 0) * a(0, 2);
+    const double s2 = a(0, 0) * a(1, 3) - a(1, 0) * a(0, 3);
+    const double s3 = a(0, 1) * a(1, 2) - a(1, 1) * a(0, 2);
+    const double s4 = a(0, 1) * a(1, 3) - a(1, 1) * a(0, 3);
+    const double s5 = a(0, 2) * a(1, 3) - a(1, 2) * a(0, 3);
+    const double c0 = a(2, 0) * a(3, 1) - a(3, 0) * a(2, 1);
+    const double c1 = a(2, 0) * a(3, 2) - a(3, 0) * a(2, 2);
+    const double c2 = a(2, 0) * a(3, 3) - a(3, 0) * a(2, 3);
+    const double c3 = a(2, 1) * a(3, 2) - a(3, 1) * a(2, 2);
+    const double c4 = a(2, 1) * a(3, 3) - a(3, 1) * a(2, 3);
+    const double c5 = a(2, 2) * a(3, 3) - a(3, 2) * a(2, 3);
+    adj[0] = a(1, 1) * c5 - a(1, 2) * c4 + a(1, 3) * c3;
+    adj[1] = -a(0, 1) * c5 + a(0, 2) * c4 - a(0, 3) * c3;
+    adj[2] = a(3, 1) * s5 - a(3, 2) * s4 + a(3, 3) * s3;
+    adj[3] = -a(2, 1) * s5 + a(2, 2) * s4 - a(2, 3) * s3;
+    adj[4] = -a(1, 0) * c5 + a(1, 2) * c2 - a(1, 3) * c1;
+    adj[5] = a(0, 0) * c5 - a(0, 2) * c2 + a(0, 3) * c1;
+    adj[6] = -a(3, 0) * s5 + a(3, 2) * s2 - a(3, 3) * s1;
+    adj[7] = a(2, 0) * s5 - a(2, 2) * s2 + a(2, 3) * s1;
+    adj[8] = a(1, 0) * c4 - a(1, 1) * c2 + a(1, 3) * c0;
+    adj[9] = -a(0, 0) * c4 + a(0, 1) * c2 - a(0, 3) * c0;
+    adj[10] = a(3, 0) * s4 - a(3, 1) * s2 + a(3, 3) * s0;
+    adj[11] = -a(2, 0) * s4 + a(2, 1) * s2 - a(2, 3) * s0;
+    adj[12] = -a(1, 0) * c3 + a(1, 1) * c1 - a(1, 2) * c0;
+    adj[13] = a(0, 0) * c3 - a(0, 1) * c1 + a(0, 2) * c0;
+    adj[14] = -a(3, 0) * s3 + a(3, 1) * s1 - a(3, 2) * s0;
+    adj[15] = a(2, 0) * s3 - a(2, 1) * s1 + a(2, 2) * s0;
+    det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+  }
+  return det;
+}
+
+template <int N>
+S21_BATCH_INLINE void DeterminantBody(const BatchGroup<N> *a, double *det,
+                                      std::size_t count) {
+  for (std::size_t g = 0; g < count; g++) {
+    for (int l = 0; l < kLanes; l++) {
+      double adj[N * N];
+      det[g * kLanes + l] = AdjugateLane(a[g], l, adj);
+    }
+  }
+}
+
+// Вырожденная матрица (det == 0) даёт нулевую обратную, поэтому нулевые
+// дорожки хвоста остаются нулевыми.
+template <int N>
+S21_BATCH_INLINE void InverseBody(const BatchGroup<N> *a, BatchGroup<N> *b,
+                                  double *det, std::size_t count) {
+  for (std::size_t g = 0; g < count; g++) {
+    for (int l = 0; l < kLanes; l++) {
+      double adj[N * N];
+      const double d = AdjugateLane(a[g], l, adj);
+      const double scale = d != 0.0 ? 1.0 / d : 0.0;
+      for (int k = 0; k < N * N; k++) b[g].e[k][l] = adj[k] * scale;
+      det[g * kLanes + l] = d;
+    }
+  }
+}
+
+template <int N>
+struct Kernels {
+  void (*mul)(const BatchGroup<N> *, const BatchGroup<N> *, BatchGroup<N> *,
+              std::size_t);
+  void (*determinant)(const BatchGroup<N> *, double *, std::size_t);
+  void (*inverse)(const BatchGroup<N> *, BatchGroup<N> *, double *,
+                  std::size_t);
+};
+
+template <int N>
+void MulDefault(const BatchGroup<N> *a, const BatchGroup<N> *b,
+                BatchGroup<N> *c, std::size_t count) {
+  MulBody(a, b, c, count);
+}
+
+template <int N>
+void DeterminantDefault(const BatchGroup<N> *a, double *det,
+                        std::size_t count) {
+  DeterminantBody(a, det, count);
+}
+
+template <int N>
+void InverseDefault(const BatchGroup<N> *a, BatchGroup<N> *b, double *det,
+                    std::size_t count) {
+  InverseBody(a, b, det, count);
+}
+
+#ifdef S21_BATCH_X86
+
+template <int N>
+__attribute__((target("avx2"))) void MulAvx2(const BatchGroup<N> *a,
+                                             const BatchGroup<N> *b,
+                                             BatchGroup<N> *c,
+                                             std::size_t count) {
+  MulBody(a, b, c, count);
+}
+
+template <int N>
+__attribute__((target("avx2"))) void DeterminantAvx2(const BatchGroup<N> *a,
+                                                     double *det,
+                                                     std::size_t count) {
+  DeterminantBody(a, det, count);
+}
+
+template <int N>
+__attribute__((target("avx2"))) void InverseAvx2(const BatchGroup<N> *a,
+                                                 BatchGroup<N> *b, double *det,
+                                                 std::size_t count) {
+  InverseBody(a, b, det, count);
+}
+
+template <int N>
+__attribute__((target("avx512f"))) void MulAvx512(const BatchGroup<N> *a,
+                                                  const BatchGroup<N> *b,
+                                                  BatchGroup<N> *c,
+                                                  std::size_t count) {
+  MulBody(a, b, c, count);
+}
+
+template <int N>
+__attribute__((target("avx512f"))) void DeterminantAvx512(
+    const BatchGroup<N> *a, double *det, std::size_t count) {
+  DeterminantBody(a, det, count);
+}
+
+template <int N>
+__attribute__((target("avx512f"))) void InverseAvx512(const BatchGroup<N> *a,
+                                                      BatchGroup<N> *b,
+                                                      double *det,
+                                                      std::size_t count) {
+  InverseBody(a, b, det, count);
+}
+
+#endif  // S21_BATCH_X86
+
+// Скалярный режим и SSE2 (базовый набор x86-64) используют версию без
+// атрибута target.
+template <int N>
+Kernels<N> Active() {
+  Kernels<N> result = {MulDefault<N>, DeterminantDefault<N>,
+                       InverseDefault<N>};
+#ifdef S21_BATCH_X86
+  const s21::simd::Isa isa = s21::simd::ActiveIsa();
+  if (isa == s21::simd::Isa::kAvx2) {
+    result = {MulAvx2<N>, DeterminantAvx2<N>, InverseAvx2<N>};
+  } else if (isa == s21::simd::Isa::kAvx512) {
+    result = {MulAvx512<N>, DeterminantAvx512<N>, InverseAvx512<N>};
+  }
+#endif
+  return result;
+}
+
+}  // namespace
+
+template <int N>
+S21MatrixBatch<N>::S21MatrixBatch(int size) : size_(size) {
+  if (size <= 0) {
+    throw std::invalid_argument("Batch size must be >0");
+  }
+  groups_.resize((size + kLanes - 1) / kLanes, BatchGroup<N>{});
+}
+
+template <int N>
+double &S21MatrixBatch<N>::operator()(int index, int i, int j) {
+  CheckIndex(index, i, j);
+  return groups_[index / kLanes].e[i * N + j][index % kLanes];
+}
+
+template <int N>
+double S21MatrixBatch<N>::operator()(int index, int i, int j) const {
+  CheckIndex(index, i, j);
+  return groups_[index / kLanes].e[i * N + j][index % kLanes];
+}
+
+template <int N>
+typename S21MatrixBatch<N>::Matrix S21MatrixBatch<N>::Get(int index) const {
+  CheckIndex(index, 0, 0);
+  Matrix result;
+  for (int i = 0; i < N; i++) {
+    for (int j = 0; j < N; j++) {
+      result(i, j) = groups_[index / kLanes].e[i * N + j][index % kLanes];
+    }
+  }
+  return result;
+}
+
+template <int N>
+void S21MatrixBatch<N>::Set(int index, const Matrix &matrix) {
+  CheckIndex(index, 0, 0);
+  for (int i = 0; i < N; i++) {
+    for (int j = 0; j < N; j++) {
+      groups_[index / kLanes].e[i * N + j][index % kLanes] = matrix(i, j);
+    }
+  }
+}
+
+template <int N>
+void S21MatrixBatch<N>::MulMatrix(const S21MatrixBatch &other) {
+  if (size_ != other.size_) {
+    throw std::invalid_argument("Batches must have the same size");
+  }
+  Active<N>().mul(groups_.data(), other.groups_.data(), groups_.data(),
+                  groups_.size());
+}
+
+// Перестановка целых 64-байтных строк группы, векторизация не нужна.
+template <int N>
+S21MatrixBatch<N> S21MatrixBatch<N>::Transpose() const {
+  S21MatrixBatch result(size_);
+  for (std::size_t g = 0; g < groups_.size(); g++) {
+    for (int i = 0; i < N; i++) {
+      for (int j = 0; j < N; j++) {
+        for (int l = 0; l < kLanes; l++) {
+          result.groups_[g].e[j * N + i][l] = groups_[g].e[i * N + j][l];
+        }
+      }
+    }
+  }
+  return result;
+}
+
+template <int N>
+std::vector<double> S21MatrixBatch<N>::Determinant() const {
+  std::vector<double> result(groups_.size() * kLanes);
+  Active<N>().determinant(groups_.data(), result.data(), groups_.size());
+  result.resize(size_);
+  return result;
+}
+
+template <int N>
+S21MatrixBatch<N> S21MatrixBatch<N>::InverseMatrix() const {
+  S21MatrixBatch result(size_);
+  std::vector<double> det(groups_.size() * kLanes);
+  Active<N>().inverse(groups_.data(), result.groups_.data(), det.data(),
+                      groups_.size());
+  for (int k = 0; k < size_; k++) {
+    if (det[k] == 0.0) {
+      throw std::runtime_error("Matrix is singular");
+    }
+  }
+  return result;
+}
+
+template <int N>
+void S21MatrixBatch<N>::CheckIndex(int index, int i, int j) const {
+  if (index < 0 || index >= size_ || i < 0 || i >= N || j < 0 || j >= N) {
+    throw std::out_of_range("Index out of bounds");
+  }
+}
+
+template class S21MatrixBatch<2>;
+template class S21MatrixBatch<3>;
+template class S21MatrixBatch<4>;
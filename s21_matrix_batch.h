@@ -0,0 +1,72 @@
+#ifndef S21_MATRIX_BATCH_H
+#define S21_MATRIX_BATCH_H
+
+#include <cstddef>
+#include <vector>
+
+#include "s21_fixed_matrix.h"
+
+namespace s21 {
+
+// Матриц в группе: одна группа элемента (i, j) занимает 64 байта —
+// регистр AVX-512, два AVX2 или четыре SSE2.
+constexpr int kBatchLanes = 8;
+
+// kBatchLanes матриц N x N, чередующихся поэлементно: элемент (i, j)
+// всех матриц группы лежит подряд, e[i * N + j][lane].
+template <int N>
+struct alignas(64) BatchGroup {
+  double e[N * N][kBatchLanes];
+};
+
+}  // namespace s21
+
+// Пакет независимых квадратных матриц N x N (N от 2 до 4) в раскладке
+// structure-of-arrays: операции выполняются сразу над kBatchLanes
+// матрицами, по одной в каждой дорожке вектора, без кучи и проверок на
+// каждую матрицу. Ядра векторизуются набором инструкций s21::simd.
+// Хвост последней группы заполнен нулями и в результатах не участвует.
+template <int N>
+class S21MatrixBatch {
+  static_assert(N >= 2 && N <= 4, "Batch matrices must be 2x2 .. 4x4");
+
+ public:
+  using Matrix = S21FixedMatrix<N, N>;
+
+  // size нулевых матриц.
+  explicit S21MatrixBatch(int size);
+
+  int GetSize() const noexcept { return size_; }
+  static constexpr int GetRows() { return N; }
+  static constexpr int GetCols() { return N; }
+
+  // Элемент (i, j) матрицы index.
+  double &operator()(int index, int i, int j);
+  double operator()(int index, int i, int j) const;
+  Matrix Get(int index) const;
+  void Set(int index, const Matrix &matrix);
+
+  // Каждая матрица умножается на матрицу с тем же индексом из other.
+  void MulMatrix(const S21MatrixBatch &other);
+  S21MatrixBatch Transpose() const;
+  // Определители всех матриц по порядку.
+  std::vector<double> Determinant() const;
+  // Бросает std::runtime_error, если хотя бы одна матрица вырождена.
+  S21MatrixBatch InverseMatrix() const;
+
+  // Сырые группы для собственных ядер: (GetSize() + 7) / 8 штук.
+  s21::BatchGroup<N> *Groups() noexcept { return groups_.data(); }
+  const s21::BatchGroup<N> *Groups() const noexcept { return groups_.data(); }
+
+ private:
+  void CheckIndex(int index, int i, int j) const;
+
+  int size_;
+  std::vector<s21::BatchGroup<N>> groups_;
+};
+
+extern template class S21MatrixBatch<2>;
+extern template class S21MatrixBatch<3>;
+extern template class S21MatrixBatch<4>;
+
+#endif
@@ -0,0 +1,365 @@
+#ifndef S21_MATRIX_EXPR_H
+#define S21_MATRIX_EXPR_H
+
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "s21_matrix_oop.h"
+
+// Ленивые поэлементные выражения: a + b - c * 2.0 строит дерево узлов без
+// выделения памяти, а вычисляется одним проходом при присваивании в
+// S21Matrix. Проверки (инициализация, размеры, конечность множителя)
+// выполняются сразу при построении узла, как и раньше в операторах.
+//
+// Вычисление идёт по строкам: Row(i) узла возвращает лёгкий объект строки,
+// у которого Load(j, bad) даёт элемент j. Строки листьев — непрерывные
+// куски буфера, поэтому внутренний цикл векторизуется. Узлы + и - как
+// SumMatrix/SubMatrix требуют конечных операндов: Load отмечает NaN или
+// бесконечность в них старшим битом bad. Умножение на число, как
+// MulNumber, ничего не проверяет.
+//
+// Каждый узел умеет отдать Reusable(layout) — временную матрицу-операнд с
+// раскладкой layout, буфер которой можно забрать под результат: вычисление
+// поэлементное, поэтому запись в элемент (i, j) не портит ещё не
+// прочитанные значения. Временная матрица с другой раскладкой не
+// подходит: результат получил бы её раскладку и шаг.
+namespace s21 {
+
+template <class E>
+class MatrixExpr {
+ public:
+  const E &Derived() const { return static_cast<const E &>(*this); }
+  E &Derived() { return static_cast<E &>(*this); }
+  int GetRows() const { return Derived().GetRows(); }
+  int GetCols() const { return Derived().GetCols(); }
+  // Раскладка результата наследуется от самого левого операнда.
+  S21Matrix::Layout GetLayout() const { return Derived().GetLayout(); }
+};
+
+// Старший бит результата установлен только для NaN и бесконечностей (все
+// единицы в порядке: перенос доходит до знака). Чистая целочисленная
+// арифметика сворачивается в векторный OR, а std::isfinite и сравнения с
+// NaN — нет.
+inline std::uint64_t NotFinite(double value) {
+  return (std::bit_cast<std::uint64_t>(value) & 0x7ff0000000000000ULL) +
+         0x0010000000000000ULL;
+}
+
+// Строка листа: row[j].
+struct LeafRow {
+  const double *row;
+  double Load(int j, std::uint64_t &) const { return row[j]; }
+};
+
+// Ссылка на живую матрицу (lvalue-операнд).
+class MatrixRef : public MatrixExpr<MatrixRef> {
+ public:
+  explicit MatrixRef(const S21Matrix &matrix)
+      : rows_(matrix.GetRows()),
+        cols_(matrix.GetCols()),
+        stride_(matrix.GetStride()),
+        layout_(matrix.GetLayout()),
+        data_(matrix.Data()) {
+    if (data_ == nullptr) {
+      throw std::runtime_error("Matrix not initialized");
+    }
+  }
+  static constexpr bool kChecksOperands = false;
+  int GetRows() const { return rows_; }
+  int GetCols() const { return cols_; }
+  S21Matrix::Layout GetLayout() const { return layout_; }
+  LeafRow Row(int i) const {
+    return {data_ + static_cast<std::size_t>(i) * stride_};
+  }
+  S21Matrix *Reusable(S21Matrix::Layout) { return nullptr; }
+
+ private:
+  int rows_, cols_, stride_;
+  S21Matrix::Layout layout_;
+  const double *data_;
+};
+
+// Временная матрица (rvalue-операнд) хранится в узле по значению, поэтому
+// выражение вида (a * b) + c не ссылается на уничтоженный объект.
+// Строки читаются через сохранённые начало буфера и шаг: после того как
+// буфер забран под результат, он остаётся жив внутри приёмника.
+class MatrixTemp : public MatrixExpr<MatrixTemp> {
+ public:
+  explicit MatrixTemp(S21Matrix &&matrix)
+      : rows_(matrix.GetRows()),
+        cols_(matrix.GetCols()),
+        stride_(matrix.GetStride()),
+        layout_(matrix.GetLayout()),
+        data_(matrix.Data()),
+        matrix_(std::move(matrix)) {
+    if (data_ == nullptr) {
+      throw std::runtime_error("Matrix not initialized");
+    }
+  }
+  static constexpr bool kChecksOperands = false;
+  int GetRows() const { return rows_; }
+  int GetCols() const { return cols_; }
+  S21Matrix::Layout GetLayout() const { return layout_; }
+  LeafRow Row(int i) const {
+    return {data_ + static_cast<std::size_t>(i) * stride_};
+  }
+  S21Matrix *Reusable(S21Matrix::Layout layout) {
+    return matrix_.getMatrix() != nullptr && layout_ == layout ? &matrix_
+                                                               : nullptr;
+  }
+
+ private:
+  int rows_, cols_, stride_;
+  S21Matrix::Layout layout_;
+  const double *data_;
+  S21Matrix matrix_;
+};
+
+struct AssignOp {
+  static double Apply(double, double b) { return b; }
+};
+
+struct PlusOp {
+  static double Apply(double a, double b) { return a + b; }
+};
+
+struct MinusOp {
+  static double Apply(double a, double b) { return a - b; }
+};
+
+template <class L, class R, class Op>
+struct BinaryRow {
+  L lhs;
+  R rhs;
+  double Load(int j, std::uint64_t &bad) const {
+    const double a = lhs.Load(j, bad);
+    const double b = rhs.Load(j, bad);
+    bad |= NotFinite(a) | NotFinite(b);
+    return Op::Apply(a, b);
+  }
+};
+
+template <class R>
+struct ScaledRow {
+  R row;
+  double num;
+  double Load(int j, std::uint64_t &bad) const {
+    return row.Load(j, bad) * num;
+  }
+};
+
+template <class L, class R, class Op>
+class BinaryExpr : public MatrixExpr<BinaryExpr<L, R, Op>> {
+ public:
+  BinaryExpr(L lhs, R rhs) : lhs_(std::move(lhs)), rhs_(std::move(rhs)) {
+    if (lhs_.GetRows() != rhs_.GetRows() || lhs_.GetCols() != rhs_.GetCols()) {
+      throw std::invalid_argument("Matrices must have the same dimensions");
+    }
+  }
+  static constexpr bool kChecksOperands = true;
+  int GetRows() const { return lhs_.GetRows(); }
+  int GetCols() const { return lhs_.GetCols(); }
+  S21Matrix::Layout GetLayout() const { return lhs_.GetLayout(); }
+  auto Row(int i) const {
+    return BinaryRow<decltype(lhs_.Row(i)), decltype(rhs_.Row(i)), Op>{
+        lhs_.Row(i), rhs_.Row(i)};
+  }
+  S21Matrix *Reusable(S21Matrix::Layout layout) {
+    S21Matrix *result = lhs_.Reusable(layout);
+    return result != nullptr ? result : rhs_.Reusable(layout);
+  }
+
+ private:
+  L lhs_;
+  R rhs_;
+};
+
+template <class E>
+class ScaledExpr : public MatrixExpr<ScaledExpr<E>> {
+ public:
+  ScaledExpr(E expr, double num) : expr_(std::move(expr)), num_(num) {
+    if (!std::isfinite(num)) {
+      throw std::invalid_argument("Number must be finite");
+    }
+  }
+  static constexpr bool kChecksOperands = E::kChecksOperands;
+  int GetRows() const { return expr_.GetRows(); }
+  int GetCols() const { return expr_.GetCols(); }
+  S21Matrix::Layout GetLayout() const { return expr_.GetLayout(); }
+  auto Row(int i) const {
+    return ScaledRow<decltype(expr_.Row(i))>{expr_.Row(i), num_};
+  }
+  S21Matrix *Reusable(S21Matrix::Layout layout) {
+    return expr_.Reusable(layout);
+  }
+
+ private:
+  E expr_;
+  double num_;
+};
+
+template <class T>
+concept MatrixNode =
+    std::derived_from<std::remove_cvref_t<T>,
+                      MatrixExpr<std::remove_cvref_t<T>>>;
+
+template <class T>
+concept MatrixOperand =
+    std::same_as<std::remove_cvref_t<T>, S21Matrix> ||
+    std::same_as<std::remove_cvref_t<T>, S21MatrixView> || MatrixNode<T>;
+
+inline MatrixRef Wrap(const S21Matrix &matrix) { return MatrixRef(matrix); }
+
+// Узел для вида определён в s21_matrix_view.h.
+class MatrixViewRef;
+inline MatrixViewRef Wrap(const S21MatrixView &view);
+
+inline MatrixTemp Wrap(S21Matrix &&matrix) {
+  return MatrixTemp(std::move(matrix));
+}
+
+template <MatrixNode E>
+std::remove_cvref_t<E> Wrap(E &&expr) {
+  return std::forward<E>(expr);
+}
+
+template <class T>
+using Node = decltype(Wrap(std::declval<T>()));
+
+}  // namespace s21
+
+template <s21::MatrixOperand L, s21::MatrixOperand R>
+s21::BinaryExpr<s21::Node<L>, s21::Node<R>, s21::PlusOp> operator+(L &&lhs,
+                                                                  R &&rhs) {
+  return {s21::Wrap(std::forward<L>(lhs)), s21::Wrap(std::forward<R>(rhs))};
+}
+
+template <s21::MatrixOperand L, s21::MatrixOperand R>
+s21::BinaryExpr<s21::Node<L>, s21::Node<R>, s21::MinusOp> operator-(L &&lhs,
+                                                                   R &&rhs) {
+  return {s21::Wrap(std::forward<L>(lhs)), s21::Wrap(std::forward<R>(rhs))};
+}
+
+template <s21::MatrixOperand T>
+s21::ScaledExpr<s21::Node<T>> operator*(T &&matrix, double num) {
+  return {s21::Wrap(std::forward<T>(matrix)), num};
+}
+
+template <s21::MatrixOperand T>
+s21::ScaledExpr<s21::Node<T>> operator*(double num, T &&matrix) {
+  return {s21::Wrap(std::forward<T>(matrix)), num};
+}
+
+// Матричное произведение не поэлементное: выражение сначала вычисляется.
+template <s21::MatrixNode L, s21::MatrixOperand R>
+S21Matrix operator*(L &&lhs, R &&rhs) {
+  S21Matrix result(lhs);
+  result *= rhs;
+  return result;
+}
+
+template <s21::MatrixNode R>
+S21Matrix operator*(const S21Matrix &lhs, R &&rhs) {
+  return lhs * S21Matrix(rhs);
+}
+
+template <class E>
+S21Matrix::S21Matrix(const s21::MatrixExpr<E> &expr) : S21Matrix() {
+  Allocate(expr.GetRows(), expr.GetCols(), expr.GetLayout());
+  Evaluate<s21::AssignOp>(expr.Derived());
+}
+
+template <class E>
+S21Matrix::S21Matrix(s21::MatrixExpr<E> &&expr) : S21Matrix() {
+  E &node = expr.Derived();
+  S21Matrix *temp = node.Reusable(node.GetLayout());
+  if (temp != nullptr) {
+    *this = std::move(*temp);
+  } else {
+    Allocate(node.GetRows(), node.GetCols(), node.GetLayout());
+  }
+  Evaluate<s21::AssignOp>(node);
+}
+
+template <class E>
+S21Matrix &S21Matrix::operator=(s21::MatrixExpr<E> &&expr) {
+  if (matrix_ == nullptr || rows_ != expr.GetRows() ||
+      cols_ != expr.GetCols()) {
+    S21Matrix fresh(std::move(expr));
+    *this = std::move(fresh);
+  } else {
+    Evaluate<s21::AssignOp>(expr.Derived());
+  }
+  return *this;
+}
+
+template <class E>
+S21Matrix &S21Matrix::operator=(const s21::MatrixExpr<E> &expr) {
+  if (matrix_ == nullptr || rows_ != expr.GetRows() ||
+      cols_ != expr.GetCols()) {
+    S21Matrix fresh(expr);
+    *this = std::move(fresh);
+  } else {
+    Evaluate<s21::AssignOp>(expr.Derived());
+  }
+  return *this;
+}
+
+template <class E>
+S21Matrix &S21Matrix::operator+=(const s21::MatrixExpr<E> &expr) {
+  CheckValidOperator();
+  if (rows_ != expr.GetRows() || cols_ != expr.GetCols()) {
+    throw std::invalid_argument("Matrices must have the same dimensions");
+  }
+  Evaluate<s21::PlusOp>(expr.Derived());
+  return *this;
+}
+
+template <class E>
+S21Matrix &S21Matrix::operator-=(const s21::MatrixExpr<E> &expr) {
+  CheckValidOperator();
+  if (rows_ != expr.GetRows() || cols_ != expr.GetCols()) {
+    throw std::invalid_argument("Matrices must have the same dimensions");
+  }
+  Evaluate<s21::MinusOp>(expr.Derived());
+  return *this;
+}
+
+// Если выражение содержит + или - (или само Op — сложение с приёмником),
+// сначала только читающий проход проверяет операнды, и при NaN или
+// бесконечности приёмник остаётся нетронутым. Затем один проход по
+// строкам: элемент (i, j) читается из выражения и сразу записывается,
+// поэтому приёмник может входить в выражение как операнд.
+template <class Op, class E>
+void S21Matrix::Evaluate(const E &expr) {
+  constexpr bool kAssign = std::is_same_v<Op, s21::AssignOp>;
+  if constexpr (E::kChecksOperands || !kAssign) {
+    std::uint64_t bad = 0;
+    for (int i = 0; i < rows_ && (bad >> 63) == 0; i++) {
+      const double *out = data_ + static_cast<std::size_t>(i) * stride_;
+      const auto row = expr.Row(i);
+      for (int j = 0; j < cols_; j++) {
+        const double value = row.Load(j, bad);
+        if constexpr (!kAssign) {
+          bad |= s21::NotFinite(out[j]) | s21::NotFinite(value);
+        }
+      }
+    }
+    if ((bad >> 63) != 0) {
+      throw std::runtime_error("Invalid matrix values");
+    }
+  }
+  for (int i = 0; i < rows_; i++) {
+    double *out = data_ + static_cast<std::size_t>(i) * stride_;
+    const auto row = expr.Row(i);
+    std::uint64_t unused = 0;
+    for (int j = 0; j < cols_; j++) {
+      out[j] = Op::Apply(out[j], row.Load(j, unused));
+    }
+  }
+}
+
+#endif
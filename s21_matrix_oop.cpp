@@ -1,68 +1,180 @@
 #include "s21_matrix_oop.h"
 
-S21Matrix::S21Matrix() : rows_(0), cols_(0), matrix_(nullptr) {}
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <limits>
+
+#include "s21_allocator.h"
+#include "s21_gemm.h"
+#include "s21_matrix_view.h"
+#include "s21_simd.h"
+#include "s21_strassen.h"
+#include "s21_transpose.h"
+
+namespace {
+
+// Шаг строки в элементах для раскладки layout.
+int StrideFor(int rows, int cols, S21Matrix::Layout layout) {
+  constexpr int kLaneDoubles = S21Matrix::kAlignment / sizeof(double);
+  int stride = cols;
+  if (layout == S21Matrix::Layout::kAligned) {
+    stride = (cols + kLaneDoubles - 1) / kLaneDoubles * kLaneDoubles;
+    // Строки с шагом, кратным 4 КиБ, попадают в одни и те же наборы кэша.
+    if (rows > 1 && (stride * sizeof(double)) % 4096 == 0) {
+      stride += kLaneDoubles;
+    }
+  }
+  return stride;
+}
+
+// Ёмкость не меньше required и не меньше удвоенной текущей.
+int Grow(int capacity, int required) {
+  const int doubled = capacity <= std::numeric_limits<int>::max() / 2
+                          ? capacity * 2
+                          : std::numeric_limits<int>::max();
+  return std::max(required, doubled);
+}
+
+// Пересекаются ли элементы вида с диапазоном [begin, end).
+bool Overlaps(const S21MatrixView &view, const double *begin,
+              const double *end) {
+  const double *first = view.RowData(0);
+  const double *last = view.RowData(view.GetRows() - 1) + view.GetCols() +
+                       (view.GetExcludedCol() < view.GetCols());
+  std::less<const double *> less;
+  return less(first, end) && less(begin, last);
+}
+
+}  // namespace
 
-S21Matrix::S21Matrix(int rows, int cols) : rows_(rows), cols_(cols) {
+S21Matrix::S21Matrix()
+    : rows_(0),
+      cols_(0),
+      stride_(0),
+      row_capacity_(0),
+      layout_(Layout::kPacked),
+      matrix_(nullptr),
+      data_(nullptr),
+      allocator_(nullptr),
+      block_bytes_(0) {}
+
+S21Matrix::S21Matrix(int rows, int cols)
+    : S21Matrix(rows, cols, Layout::kPacked) {}
+
+S21Matrix::S21Matrix(int rows, int cols, Layout layout) : S21Matrix() {
   if (rows <= 0 || cols <= 0) {
     throw std::invalid_argument("Rows and columns must be >0");
   }
-  matrix_ = new double *[rows];
-  for (int i = 0; i < rows; i++) {
-    matrix_[i] = new double[cols]();
-  }
+  Allocate(rows, cols, layout);
+  std::memset(data_, 0, sizeof(double) * rows_ * stride_);
 }
 
-S21Matrix::S21Matrix(const S21Matrix &other)
-    : rows_(other.rows_), cols_(other.cols_) {
-  matrix_ = new double *[rows_];
-  for (int i = 0; i < rows_; i++) {
-    matrix_[i] = new double[cols_];
-  }
-  for (int i = 0; i < rows_; i++) {
-    for (int j = 0; j < cols_; j++) {
-      matrix_[i][j] = other.matrix_[i][j];
-    }
+S21Matrix::S21Matrix(const S21Matrix &other) : S21Matrix() {
+  layout_ = other.layout_;
+  if (other.matrix_ != nullptr) {
+    Allocate(other.rows_, other.cols_, other.layout_);
+    CopyData(other);
   }
 }
 
 S21Matrix::S21Matrix(S21Matrix &&other)
-    : rows_(other.rows_), cols_(other.cols_), matrix_(other.matrix_) {
+    : rows_(other.rows_),
+      cols_(other.cols_),
+      stride_(other.stride_),
+      row_capacity_(other.row_capacity_),
+      layout_(other.layout_),
+      matrix_(other.matrix_),
+      data_(other.data_),
+      allocator_(other.allocator_),
+      block_bytes_(other.block_bytes_) {
   other.matrix_ = nullptr;
-  other.rows_ = other.cols_ = 0;
+  other.data_ = nullptr;
+  other.rows_ = other.cols_ = other.stride_ = other.row_capacity_ = 0;
+}
+
+S21Matrix::~S21Matrix() { Release(); }
+
+// Один блок на всю матрицу из текущего аллокатора (выровнен на
+// kAlignment): сначала row_capacity указателей на строки (дополненные до
+// kAlignment), затем row_capacity * stride элементов (row-major). Ёмкость
+// не меньше логических размеров; элементы не инициализируются.
+void S21Matrix::Allocate(int rows, int cols, Layout layout, int row_capacity,
+                         int col_capacity) {
+  row_capacity = std::max(rows, row_capacity);
+  const int stride =
+      StrideFor(row_capacity, std::max(cols, col_capacity), layout);
+  std::size_t table = sizeof(double *) * row_capacity;
+  table = (table + kAlignment - 1) / kAlignment * kAlignment;
+  std::size_t count = static_cast<std::size_t>(row_capacity) * stride;
+  s21::MatrixAllocator &allocator = s21::GetMatrixAllocator();
+  const std::size_t bytes = table + sizeof(double) * count;
+  void *block = allocator.Allocate(bytes);
+  allocator_ = &allocator;
+  block_bytes_ = bytes;
+  matrix_ = static_cast<double **>(block);
+  data_ = reinterpret_cast<double *>(static_cast<char *>(block) + table);
+  for (int i = 0; i < row_capacity; i++) {
+    matrix_[i] = data_ + static_cast<std::size_t>(i) * stride;
+  }
+  rows_ = rows;
+  cols_ = cols;
+  stride_ = stride;
+  row_capacity_ = row_capacity;
+  layout_ = layout;
+}
+
+// Переносит элементы в новый блок с заданной ёмкостью; дополнение строк
+// до шага обнуляется, строки за rows_ не инициализируются.
+void S21Matrix::Reallocate(int row_capacity, int col_capacity) {
+  S21Matrix grown;
+  grown.Allocate(rows_, cols_, layout_, row_capacity, col_capacity);
+  for (int i = 0; i < rows_; i++) {
+    double *tail = std::copy(matrix_[i], matrix_[i] + cols_, grown.matrix_[i]);
+    std::fill(tail, grown.matrix_[i] + grown.stride_, 0.0);
+  }
+  *this = std::move(grown);
 }
 
-S21Matrix::~S21Matrix() {
+void S21Matrix::Release() {
   if (matrix_ != nullptr) {
+    allocator_->Deallocate(matrix_, block_bytes_);
+  }
+  matrix_ = nullptr;
+  data_ = nullptr;
+  allocator_ = nullptr;
+  block_bytes_ = 0;
+  rows_ = 0;
+  cols_ = 0;
+  stride_ = 0;
+  row_capacity_ = 0;
+}
+
+// Размеры совпадают; при одинаковом stride копируется весь буфер разом.
+void S21Matrix::CopyData(const S21Matrix &other) {
+  if (stride_ == other.stride_) {
+    std::memcpy(data_, other.data_, sizeof(double) * rows_ * stride_);
+  } else {
     for (int i = 0; i < rows_; i++) {
-      delete[] matrix_[i];
+      std::memcpy(matrix_[i], other.matrix_[i], sizeof(double) * cols_);
     }
-    delete[] matrix_;
-    matrix_ = nullptr;
-    rows_ = 0;
-    cols_ = 0;
   }
 }
 
 bool S21Matrix::EqMatrix(const S21Matrix &other) const {
   CheckValidMatrix(other);
-  bool result = true;
-  int done = 0;
-  while (!done) {
-    if (rows_ != other.rows_ || cols_ != other.cols_) {
-      result = false;
-      done = 1;
-    }
-    for (int i = 0; i < rows_ && !done; i++) {
-      for (int j = 0; j < cols_; j++) {
-        if (std::abs(matrix_[i][j] - other.matrix_[i][j]) > 1e-7) {
-          result = false;
-          done = 1;
-        }
-      }
-    }
-    done = 1;
-  }
-  return result;
+  return S21MatrixView(*this).EqMatrix(other);
+}
+
+bool S21Matrix::EqMatrix(const S21MatrixView &other) const {
+  CheckValidOperator();
+  return S21MatrixView(*this).EqMatrix(other);
+}
+
+bool S21Matrix::EqMatrix(const S21MatrixView &other,
+                         Tolerance tolerance) const {
+  CheckValidOperator();
+  return S21MatrixView(*this).EqMatrix(other, tolerance);
 }
 
 void S21Matrix::SumMatrix(const S21Matrix &other) {
@@ -75,15 +187,23 @@ void S21Matrix::SubMatrix(const S21Matrix &other) {
   SimpleArithmetic(other, -1);
 }
 
+void S21Matrix::SumMatrix(const S21MatrixView &other) {
+  CheckValidOperator();
+  SimpleArithmetic(other, 1);
+}
+
+void S21Matrix::SubMatrix(const S21MatrixView &other) {
+  CheckValidOperator();
+  SimpleArithmetic(other, -1);
+}
+
 void S21Matrix::MulNumber(const double num) {
   CheckValidOperator();
   if (!std::isfinite(num)) {
     throw std::invalid_argument("Number must be finite");
   }
   for (int i = 0; i < rows_; i++) {
-    for (int j = 0; j < cols_; j++) {
-      matrix_[i][j] *= num;
-    }
+    s21::simd::Scale(matrix_[i], num, cols_);
   }
 }
 
@@ -92,110 +212,137 @@ void S21Matrix::MulMatrix(const S21Matrix &other) {
   if (cols_ != other.rows_) {
     throw std::invalid_argument("Invalid dimensions for multiplication");
   }
-  S21Matrix result(rows_, other.cols_);
-  for (int i = 0; i < rows_; i++) {
-    for (int j = 0; j < other.cols_; j++) {
-      result.matrix_[i][j] = 0;
-      for (int k = 0; k < cols_; k++) {
-        result.matrix_[i][j] += matrix_[i][k] * other.matrix_[k][j];
-      }
+  *this = *this * other;
+}
+
+void S21Matrix::MulMatrix(const S21MatrixView &other) {
+  CheckValidOperator();
+  *this = S21MatrixView(*this) * other;
+}
+
+void S21Matrix::MulMatrix(const S21MatrixView &other,
+                          MulAlgorithm algorithm) {
+  CheckValidOperator();
+  if (algorithm == MulAlgorithm::kClassical) {
+    MulMatrix(other);
+  } else {
+    if (cols_ != other.GetRows()) {
+      throw std::invalid_argument("Invalid dimensions for multiplication");
     }
+    S21Matrix packed;
+    if (other.HasExclusions()) packed = other.ToMatrix();
+    const S21MatrixView b = other.HasExclusions() ? packed : other;
+    S21Matrix result(rows_, b.GetCols(), layout_);
+    s21::StrassenGemm(rows_, b.GetCols(), cols_, data_, stride_,
+                      b.RowData(0), b.GetStride(), result.data_,
+                      result.stride_);
+    *this = std::move(result);
+  }
+}
+
+// Вид с исключениями или перекрывающийся с *this копируется: GEMM
+// требует постоянного шага и не должен читать уже записанные элементы C.
+void S21Matrix::Gemm(double alpha, const S21MatrixView &a,
+                     const S21MatrixView &b, double beta, bool transpose_a,
+                     bool transpose_b) {
+  CheckValidOperator();
+  if (!std::isfinite(alpha) || !std::isfinite(beta)) {
+    throw std::invalid_argument("Number must be finite");
   }
-  for (int i = 0; i < rows_; i++) {
-    delete[] matrix_[i];
+  const int m = transpose_a ? a.GetCols() : a.GetRows();
+  const int k = transpose_a ? a.GetRows() : a.GetCols();
+  const int n = transpose_b ? b.GetRows() : b.GetCols();
+  const int kb = transpose_b ? b.GetCols() : b.GetRows();
+  if (m != rows_ || n != cols_ || k != kb) {
+    throw std::invalid_argument("Invalid dimensions for multiplication");
   }
-  delete[] matrix_;
-  matrix_ = result.matrix_;
-  cols_ = other.cols_;
-  result.matrix_ = nullptr;
+  const double *end = data_ + static_cast<std::size_t>(rows_) * stride_;
+  S21Matrix packed_a;
+  S21Matrix packed_b;
+  if (a.HasExclusions() || Overlaps(a, data_, end)) packed_a = a.ToMatrix();
+  if (b.HasExclusions() || Overlaps(b, data_, end)) packed_b = b.ToMatrix();
+  const S21MatrixView op_a = packed_a.Data() ? S21MatrixView(packed_a) : a;
+  const S21MatrixView op_b = packed_b.Data() ? S21MatrixView(packed_b) : b;
+  s21::Gemm(transpose_a ? s21::Trans::kYes : s21::Trans::kNo,
+            transpose_b ? s21::Trans::kYes : s21::Trans::kNo, m, n, k, alpha,
+            op_a.RowData(0), op_a.GetStride(), op_b.RowData(0),
+            op_b.GetStride(), beta, data_, stride_);
 }
 
 S21Matrix S21Matrix::Transpose() {
   CheckValidOperator();
-  S21Matrix result(cols_, rows_);
-  for (int i = 0; i < rows_; i++) {
-    for (int j = 0; j < cols_; j++) {
-      result.matrix_[j][i] = matrix_[i][j];
+  return S21MatrixView(*this).Transpose();
+}
+
+// Квадратная матрица транспонируется на месте в любой раскладке. У
+// прямоугольной строки сдвигаются вплотную, переставляются по циклам и
+// раздвигаются под шаг новой формы внутри того же буфера. Если таблица
+// строк или буфер данных не вмещают новую форму (у широкой матрицы строк
+// становится больше, если их не зарезервировали), результат строится в
+// новом буфере.
+void S21Matrix::TransposeInPlace() {
+  CheckValidOperator();
+  const int new_stride = StrideFor(cols_, rows_, layout_);
+  const std::size_t table = reinterpret_cast<char *>(data_) -
+                            reinterpret_cast<char *>(matrix_);
+  const std::size_t capacity =
+      static_cast<std::size_t>(row_capacity_) * stride_;
+  const bool fits =
+      sizeof(double *) * cols_ <= table &&
+      static_cast<std::size_t>(cols_) * new_stride <= capacity;
+  if (rows_ == cols_) {
+    s21::TransposeSquare(rows_, data_, stride_);
+  } else if (fits) {
+    for (int i = 1; i < rows_; i++) {
+      std::memmove(data_ + static_cast<std::size_t>(i) * cols_, matrix_[i],
+                   sizeof(double) * cols_);
     }
+    s21::TransposePacked(rows_, cols_, data_);
+    std::swap(rows_, cols_);
+    stride_ = new_stride;
+    row_capacity_ = static_cast<int>(
+        std::min(table / sizeof(double *), capacity / stride_));
+    for (int i = row_capacity_ - 1; i >= rows_; i--) {
+      matrix_[i] = data_ + static_cast<std::size_t>(i) * stride_;
+    }
+    for (int i = rows_ - 1; i >= 0; i--) {
+      matrix_[i] = data_ + static_cast<std::size_t>(i) * stride_;
+      std::memmove(matrix_[i], data_ + static_cast<std::size_t>(i) * cols_,
+                   sizeof(double) * cols_);
+      std::fill(matrix_[i] + cols_, matrix_[i] + stride_, 0.0);
+    }
+  } else {
+    *this = Transpose();
   }
-  return result;
 }
 
 S21Matrix S21Matrix::CalcComplements() {
   CheckValidOperator();
-  if (rows_ != cols_) {
-    throw std::invalid_argument("Matrix must be square");
-  }
-  S21Matrix result(rows_, cols_);
-  for (int i = 0; i < rows_; i++) {
-    for (int j = 0; j < cols_; j++) {
-      S21Matrix minor = GetMinor(i, j);
-      double det = minor.Determinant();
-      result(i, j) = ((i + j) % 2 == 0 ? 1 : -1) * det;
-    }
-  }
-  return result;
+  return S21MatrixView(*this).CalcComplements();
 }
 
 double S21Matrix::Determinant() {
-  double result = 0.0;
   CheckValidOperator();
-  if (rows_ != cols_) throw std::invalid_argument("Matrix must be square");
-
-  if (rows_ == 1) {
-    result = (*this)(0, 0);
-  } else if (rows_ == 2) {
-    result = (*this)(0, 0) * (*this)(1, 1) - (*this)(1, 0) * (*this)(0, 1);
-  } else {
-    for (int j = 0; j < cols_; j++) {
-      S21Matrix minor = GetMinor(0, j);
-      int sign = (j % 2 == 0) ? 1 : -1;
-      result += (*this)(0, j) * sign * minor.Determinant();
-    }
-  }
-
-  return result;
+  return S21MatrixView(*this).Determinant();
 }
 S21Matrix S21Matrix::InverseMatrix() {
   CheckValidOperator();
-  double det = Determinant();
-  if (det == 0) {
-    throw std::runtime_error("Matrix is singular");
-  }
-  S21Matrix complements = CalcComplements();
-  S21Matrix adjugate = complements.Transpose();
-  adjugate.MulNumber(1.0 / det);
-  return adjugate;
+  return S21MatrixView(*this).InverseMatrix();
 }
-
-S21Matrix S21Matrix::operator+(const S21Matrix &other) const {
-  CheckValidMatrix(other);
-  CheckValidDimensions(other);
-  S21Matrix result(*this);
-  result += other;
-  return result;
+S21Matrix S21Matrix::Solve(const S21MatrixView &b) {
+  CheckValidOperator();
+  return S21MatrixView(*this).Solve(b);
 }
 
-S21Matrix S21Matrix::operator-(const S21Matrix &other) const {
+// Произведение сразу пишется в новый буфер: копия *this не нужна.
+S21Matrix S21Matrix::operator*(const S21Matrix &other) const {
   CheckValidMatrix(other);
-  CheckValidDimensions(other);
-  S21Matrix result(*this);
-  result -= other;
-  return result;
+  return S21MatrixView(*this) * other;
 }
 
-S21Matrix S21Matrix::operator*(const double num) const {
+S21Matrix S21Matrix::operator*(const S21MatrixView &other) const {
   CheckValidOperator();
-  S21Matrix result(*this);
-  result *= num;
-  return result;
-}
-
-S21Matrix S21Matrix::operator*(const S21Matrix &other) const {
-  CheckValidMatrix(other);
-  S21Matrix result(*this);
-  result *= other;
-  return result;
+  return S21MatrixView(*this) * other;
 }
 
 bool S21Matrix::operator==(const S21Matrix &other) const {
@@ -246,20 +393,15 @@ double &S21Matrix::operator()(int i, int j) const {
 // копирующий опреатор присваивания
 S21Matrix &S21Matrix::operator=(const S21Matrix &other) {
   if (this != &other) {
-    if (matrix_ != nullptr) {
-      for (int i = 0; i < rows_; i++) {
-        delete[] matrix_[i];
-      }
-      delete[] matrix_;
-    }
-    rows_ = other.rows_;
-    cols_ = other.cols_;
-    matrix_ = new double *[rows_];
-    for (int i = 0; i < rows_; i++) {
-      matrix_[i] = new double[cols_];
-      for (int j = 0; j < cols_; j++) {
-        matrix_[i][j] = other.matrix_[i][j];
+    if (other.matrix_ == nullptr) {
+      Release();
+    } else {
+      if (rows_ != other.rows_ || cols_ != other.cols_ ||
+          layout_ != other.layout_ || matrix_ == nullptr) {
+        Release();
+        Allocate(other.rows_, other.cols_, other.layout_);
       }
+      CopyData(other);
     }
   }
   return *this;
@@ -267,20 +409,24 @@ S21Matrix &S21Matrix::operator=(const S21Matrix &other) {
 // перемещающий оператор присваивания
 S21Matrix &S21Matrix::operator=(S21Matrix &&other) noexcept {
   if (this != &other) {
-    if (matrix_ != nullptr) {
-      for (int i = 0; i < rows_; i++) {
-        delete[] matrix_[i];
-      }
-      delete[] matrix_;
-    }
+    Release();
 
     rows_ = other.rows_;
     cols_ = other.cols_;
+    stride_ = other.stride_;
+    row_capacity_ = other.row_capacity_;
+    layout_ = other.layout_;
     matrix_ = other.matrix_;
+    data_ = other.data_;
+    allocator_ = other.allocator_;
+    block_bytes_ = other.block_bytes_;
 
     other.rows_ = 0;
     other.cols_ = 0;
+    other.stride_ = 0;
+    other.row_capacity_ = 0;
     other.matrix_ = nullptr;
+    other.data_ = nullptr;
   }
   return *this;
 }
@@ -294,24 +440,13 @@ void S21Matrix::SetRows(int new_rows) {
   if (cols_ <= 0) {
     throw std::invalid_argument("Columns must be > 0");
   }
-  if (new_rows != rows_) {
-    S21Matrix new_matrix(new_rows, cols_);
-    int rows_to_copy = std::min(rows_, new_rows);
-    for (int i = 0; i < rows_to_copy; i++) {
-      std::copy(matrix_[i], matrix_[i] + cols_, new_matrix.matrix_[i]);
-    }
-    for (int i = 0; i < rows_; i++) {
-      delete[] matrix_[i];
-    }
-    delete[] matrix_;
-    matrix_ = new_matrix.matrix_;
-    rows_ = new_rows;
-    cols_ = new_matrix.cols_;
-
-    new_matrix.matrix_ = nullptr;
-    new_matrix.rows_ = 0;
-    new_matrix.cols_ = 0;
+  if (new_rows > row_capacity_) {
+    Reallocate(Grow(row_capacity_, new_rows), stride_);
+  }
+  for (int i = rows_; i < new_rows; i++) {
+    std::fill(matrix_[i], matrix_[i] + cols_, 0.0);
   }
+  rows_ = new_rows;
 }
 
 void S21Matrix::SetCols(int new_cols) {
@@ -324,53 +459,52 @@ void S21Matrix::SetCols(int new_cols) {
   if (rows_ <= 0) {
     throw std::invalid_argument("Rows must be > 0");
   }
-  if (new_cols != cols_) {
-    S21Matrix new_matrix(rows_, new_cols);
-    int cols_to_copy = std::min(cols_, new_cols);
-    for (int i = 0; i < rows_; i++) {
-      std::copy(matrix_[i], matrix_[i] + cols_to_copy, new_matrix.matrix_[i]);
-    }
-    for (int i = 0; i < rows_; i++) {
-      delete[] matrix_[i];
-    }
-    delete[] matrix_;
-    matrix_ = new_matrix.matrix_;
-    cols_ = new_cols;
-    rows_ = new_matrix.rows_;
+  if (new_cols > stride_) {
+    Reallocate(row_capacity_, Grow(stride_, new_cols));
+  }
+  for (int i = 0; i < rows_ && new_cols > cols_; i++) {
+    std::fill(matrix_[i] + cols_, matrix_[i] + new_cols, 0.0);
+  }
+  cols_ = new_cols;
+}
 
-    new_matrix.matrix_ = nullptr;
-    new_matrix.cols_ = 0;
-    new_matrix.rows_ = 0;
+void S21Matrix::Reserve(int rows, int cols) {
+  if (rows <= 0 || cols <= 0) {
+    throw std::invalid_argument("Rows and columns must be >0");
+  }
+  if (matrix_ == nullptr) {
+    throw std::runtime_error("Matrix not initialized");
+  }
+  if (rows > row_capacity_ || cols > stride_) {
+    Reallocate(std::max(rows, row_capacity_), std::max(cols, stride_));
   }
 }
 
+int S21Matrix::GetRowCapacity() const { return row_capacity_; }
+
+int S21Matrix::GetColCapacity() const { return stride_; }
+
 int S21Matrix::GetCols() const { return cols_; }
 
 int S21Matrix::GetRows() const { return rows_; }
 
+int S21Matrix::GetStride() const { return stride_; }
+
+S21Matrix::Layout S21Matrix::GetLayout() const { return layout_; }
+
 double **S21Matrix::getMatrix() const { return matrix_; }
 
 void S21Matrix::setMatrix(double **values, int rows, int cols) {
   if (rows <= 0 || cols <= 0) {
     throw std::invalid_argument("Rows and columns must be >0");
   }
-  if (matrix_ != nullptr) {
-    for (int i = 0; i < rows_; i++) {
-      delete[] matrix_[i];
-    }
-    delete[] matrix_;
-  }
+  Release();
   rows_ = rows;
   cols_ = cols;
-  if (values == nullptr) {
-    matrix_ = nullptr;
-  } else {
-    matrix_ = new double *[rows_];
+  if (values != nullptr) {
+    Allocate(rows, cols, layout_);
     for (int i = 0; i < rows_; i++) {
-      matrix_[i] = new double[cols_];
-      for (int j = 0; j < cols_; j++) {
-        matrix_[i][j] = values[i][j];
-      }
+      std::memcpy(matrix_[i], values[i], sizeof(double) * cols_);
     }
   }
 }
@@ -381,18 +515,14 @@ S21Matrix S21Matrix::GetMinor(int excluded_row, int excluded_col) const {
     throw std::out_of_range("Invalid excluded row or column");
   }
   S21Matrix minor(rows_ - 1, cols_ - 1);
+  // Каждая строка минора — два непрерывных куска исходной строки.
   int mi = 0;
-
   for (int i = 0; i < rows_; i++) {
     if (i != excluded_row) {
-      int mj = 0;
-      for (int j = 0; j < cols_; j++) {
-        if (j != excluded_col) {
-          minor(mi, mj) = (*this)(i, j);
-          mj++;
-        }
-      }
-      mi++;
+      const std::span<double> src = Row(i);
+      double *dst = minor.Row(mi++).data();
+      dst = std::copy(src.begin(), src.begin() + excluded_col, dst);
+      std::copy(src.begin() + excluded_col + 1, src.end(), dst);
     }
   }
   return minor;
@@ -402,13 +532,26 @@ void S21Matrix::SimpleArithmetic(const S21Matrix &other, short sign) {
   if (rows_ != other.rows_ || cols_ != other.cols_) {
     throw std::invalid_argument("Matrices must have the same dimensions");
   }
+  if (matrix_ != nullptr) SimpleArithmetic(S21MatrixView(other), sign);
+}
+
+// Проверка конечности идёт векторно вместе со сложением; строка с
+// NaN/бесконечностью успевает обновиться до исключения. Строка вида с
+// исключённым столбцом обрабатывается двумя непрерывными кусками.
+void S21Matrix::SimpleArithmetic(const S21MatrixView &other, short sign) {
+  if (rows_ != other.GetRows() || cols_ != other.GetCols()) {
+    throw std::invalid_argument("Matrices must have the same dimensions");
+  }
+  const int split = other.GetExcludedCol();
   for (int i = 0; i < rows_; i++) {
-    for (int j = 0; j < cols_; j++) {
-      if (!std::isfinite(matrix_[i][j]) ||
-          !std::isfinite(other.matrix_[i][j])) {
-        throw std::runtime_error("Invalid matrix values");
-      }
-      matrix_[i][j] = matrix_[i][j] + sign * other.matrix_[i][j];
+    const double *src = other.RowData(i);
+    bool finite = s21::simd::AddScaled(matrix_[i], src, sign, split);
+    if (split < cols_) {
+      finite &= s21::simd::AddScaled(matrix_[i] + split, src + split + 1,
+                                     sign, cols_ - split);
+    }
+    if (!finite) {
+      throw std::runtime_error("Invalid matrix values");
     }
   }
 }
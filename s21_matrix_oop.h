@@ -3,14 +3,81 @@
 
 #include <gtest/gtest.h>
 
+#include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <iostream>
+#include <span>
 #include <stdexcept>
 
+namespace s21 {
+template <class E>
+class MatrixExpr;
+class MatrixAllocator;
+}  // namespace s21
+
+class S21MatrixView;
+
 class S21Matrix {
+ public:
+  // kPacked: строки идут вплотную, stride == cols (пока ёмкость по
+  // столбцам не больше cols, см. Reserve).
+  // kAligned: каждая строка начинается на границе 64 байт, stride дополнен
+  // до кратного 8; если строка занимает кратное 4096 байт (и строк больше
+  // одной), stride увеличивается ещё на 8 (против 4K-aliasing).
+  enum class Layout { kPacked, kAligned };
+  static constexpr std::size_t kAlignment = 64;
+
+  // Допуск сравнения элементов в EqMatrix:
+  // kAbsolute — |a - b| <= value (NaN ничему не противоречит);
+  // kRelative — a == b или |a - b| <= value * max(|a|, |b|);
+  // kUlp — между a и b не больше value представимых double.
+  // В kRelative и kUlp NaN не равен ничему.
+  struct Tolerance {
+    enum class Mode { kAbsolute, kRelative, kUlp };
+    Mode mode;
+    double value;
+
+    static constexpr Tolerance Absolute(double value) {
+      return {Mode::kAbsolute, value};
+    }
+    static constexpr Tolerance Relative(double value) {
+      return {Mode::kRelative, value};
+    }
+    static constexpr Tolerance Ulp(double value) { return {Mode::kUlp, value}; }
+  };
+  static constexpr Tolerance kDefaultTolerance{Tolerance::Mode::kAbsolute,
+                                               1e-7};
+
+  // Алгоритм MulMatrix: kClassical — блочный Gemm, kStrassen —
+  // Штрассен–Виноград для больших произведений (см. s21_strassen.h):
+  // меньше умножений, но больше сложений и погрешность. Пока какой-то
+  // размер не больше s21::kStrassenCrossover, kStrassen совпадает с
+  // kClassical.
+  enum class MulAlgorithm { kClassical, kStrassen };
+
  private:
   int rows_, cols_;
+  // Расстояние между началами соседних строк в элементах (leading dimension).
+  int stride_;
+  // Строк, под которые выделены таблица и буфер (>= rows_); ёмкость по
+  // столбцам — stride_.
+  int row_capacity_;
+  Layout layout_;
+  // Таблица указателей на строки и сами данные живут в одном блоке памяти:
+  // matrix_[i] указывает на строку i внутри непрерывного буфера data_.
   double **matrix_;
+  double *data_;
+  // Откуда взят блок (см. s21_allocator.h) и его размер в байтах.
+  s21::MatrixAllocator *allocator_;
+  std::size_t block_bytes_;
+  void Allocate(int rows, int cols, Layout layout, int row_capacity = 0,
+                int col_capacity = 0);
+  void Reallocate(int row_capacity, int col_capacity);
+  void Release();
+  void CopyData(const S21Matrix &other);
+  template <class Op, class E>
+  void Evaluate(const E &expr);
   void CheckValidMatrix(const S21Matrix &other) const;
   void CheckValidOperator() const;
   void CheckValidDimensions(const S21Matrix &other) const;
@@ -18,8 +85,15 @@ class S21Matrix {
  public:
   S21Matrix();
   S21Matrix(int rows, int cols);
+  S21Matrix(int rows, int cols, Layout layout);
   S21Matrix(const S21Matrix &other);
   S21Matrix(S21Matrix &&other);
+  // Вычисляет ленивое поэлементное выражение (см. s21_matrix_expr.h).
+  template <class E>
+  S21Matrix(const s21::MatrixExpr<E> &expr);
+  // Временное выражение может отдать буфер своего rvalue-операнда.
+  template <class E>
+  S21Matrix(s21::MatrixExpr<E> &&expr);
   ~S21Matrix();
 
   bool EqMatrix(const S21Matrix &other) const;
@@ -27,32 +101,84 @@ class S21Matrix {
   void SubMatrix(const S21Matrix &other);
   void MulNumber(const double num);
   void MulMatrix(const S21Matrix &other);
+  // Второй операнд — вид на часть матрицы (см. s21_matrix_view.h).
+  bool EqMatrix(const S21MatrixView &other) const;
+  bool EqMatrix(const S21MatrixView &other, Tolerance tolerance) const;
+  void SumMatrix(const S21MatrixView &other);
+  void SubMatrix(const S21MatrixView &other);
+  void MulMatrix(const S21MatrixView &other);
+  void MulMatrix(const S21MatrixView &other, MulAlgorithm algorithm);
+  // *this = alpha * op(a) * op(b) + beta * *this, где op — транспонирование
+  // по флагу. Результат пишется прямо в матрицу, без временных копий.
+  void Gemm(double alpha, const S21MatrixView &a, const S21MatrixView &b,
+            double beta, bool transpose_a = false, bool transpose_b = false);
   S21Matrix Transpose();
+  // Транспонирует матрицу без второго буфера данных (см. реализацию).
+  void TransposeInPlace();
   S21Matrix CalcComplements();
   double Determinant();
   S21Matrix InverseMatrix();
+  // X из *this * X = b через LU; быстрее и точнее InverseMatrix() * b.
+  // Для высокой матрицы — наименьшие квадраты через QR.
+  S21Matrix Solve(const S21MatrixView &b);
 
-  S21Matrix operator+(const S21Matrix &other) const;
-  S21Matrix operator-(const S21Matrix &other) const;
-  S21Matrix operator*(const double num) const;
+  // operator+, operator- и operator*(double) возвращают ленивые выражения
+  // и объявлены в s21_matrix_expr.h.
   S21Matrix operator*(const S21Matrix &other) const;
+  S21Matrix operator*(const S21MatrixView &other) const;
   bool operator==(const S21Matrix &other) const;
   S21Matrix &operator+=(const S21Matrix &other);
   S21Matrix &operator-=(const S21Matrix &other);
   S21Matrix &operator*=(const double num);
   S21Matrix &operator*=(const S21Matrix &other);
   double &operator()(int i, int j) const;
+
+  // Доступ без проверок для горячих циклов: индексы проверяются только
+  // assert в отладочной сборке. Строка i — непрерывные cols элементов,
+  // соседние строки отстоят на GetStride() элементов от Data().
+  double &At(int i, int j) const noexcept {
+    assert(matrix_ != nullptr && i >= 0 && i < rows_ && j >= 0 && j < cols_);
+    return matrix_[i][j];
+  }
+  std::span<double> Row(int i) const noexcept {
+    assert(matrix_ != nullptr && i >= 0 && i < rows_);
+    return {matrix_[i], static_cast<std::size_t>(cols_)};
+  }
+  double *Data() const noexcept { return data_; }
   S21Matrix &operator=(const S21Matrix &other);
   S21Matrix &operator=(S21Matrix &&other) noexcept;
+  template <class E>
+  S21Matrix &operator=(const s21::MatrixExpr<E> &expr);
+  template <class E>
+  S21Matrix &operator=(s21::MatrixExpr<E> &&expr);
+  template <class E>
+  S21Matrix &operator+=(const s21::MatrixExpr<E> &expr);
+  template <class E>
+  S21Matrix &operator-=(const s21::MatrixExpr<E> &expr);
 
+  // В пределах ёмкости размеры меняются без перераспределения памяти;
+  // при выходе за неё ёмкость растёт геометрически (не менее чем вдвое),
+  // поэтому добавление строк по одной стоит амортизированно O(cols).
+  // Уменьшение никогда не перераспределяет память.
   void SetRows(int new_rows);
   void SetCols(int new_cols);
+  // Резервирует место под rows x cols элементов. Ёмкость не уменьшается.
+  void Reserve(int rows, int cols);
+  int GetRowCapacity() const;
+  int GetColCapacity() const;
   int GetRows() const;
   int GetCols() const;
+  int GetStride() const;
+  Layout GetLayout() const;
 
   void setMatrix(double **values, int rows, int cols);
   double **getMatrix() const;
   S21Matrix GetMinor(int excluded_row, int excluded_col) const;
   void SimpleArithmetic(const S21Matrix &other, short sign);
+  void SimpleArithmetic(const S21MatrixView &other, short sign);
 };
+
+#include "s21_matrix_expr.h"
+#include "s21_matrix_view.h"
+
 #endif
\ No newline at end of file
@@ -0,0 +1,288 @@
+#include "s21_matrix_view.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "s21_gemm.h"
+#include "s21_lu.h"
+#include "s21_qr.h"
+#include "s21_simd.h"
+#include "s21_transpose.h"
+
+namespace {
+
+// Строка i вида в непрерывный буфер dst (cols элементов).
+void CopyRow(const S21MatrixView &view, int i, double *dst) {
+  const double *src = view.RowData(i);
+  const int split = view.GetExcludedCol();
+  std::copy(src, src + split, dst);
+  if (split < view.GetCols()) {
+    std::copy(src + split + 1, src + view.GetCols() + 1, dst + split);
+  }
+}
+
+// n элементов подряд в режиме tolerance.mode.
+bool Within(const double *a, const double *b, int n,
+            S21Matrix::Tolerance tolerance) {
+  using Mode = S21Matrix::Tolerance::Mode;
+  bool result = true;
+  if (tolerance.mode == Mode::kAbsolute) {
+    result = s21::simd::WithinTolerance(a, b, tolerance.value, n);
+  } else if (tolerance.mode == Mode::kRelative) {
+    result = s21::simd::WithinRelative(a, b, tolerance.value, n);
+  } else {
+    // Порог от 2^64 не представим в uint64 и насыщается до UINT64_MAX:
+    // это больше любого расстояния между не-NaN значениями.
+    const std::uint64_t ulps =
+        tolerance.value >= 0x1p64
+            ? std::numeric_limits<std::uint64_t>::max()
+            : static_cast<std::uint64_t>(tolerance.value);
+    result = s21::simd::WithinUlps(a, b, ulps, n);
+  }
+  return result;
+}
+
+}  // namespace
+
+S21MatrixView::S21MatrixView(const S21Matrix &matrix)
+    : S21MatrixView(matrix.Data(), matrix.GetRows(), matrix.GetCols(),
+                    matrix.GetStride(), matrix.GetLayout()) {}
+
+S21MatrixView::S21MatrixView(const double *data, int rows, int cols,
+                             int stride)
+    : S21MatrixView(data, rows, cols, stride, S21Matrix::Layout::kPacked) {}
+
+S21MatrixView::S21MatrixView(const double *data, int rows, int cols,
+                             int stride, S21Matrix::Layout layout)
+    : data_(data),
+      rows_(rows),
+      cols_(cols),
+      stride_(stride),
+      excluded_row_(rows),
+      excluded_col_(cols),
+      layout_(layout) {
+  if (data == nullptr) {
+    throw std::runtime_error("Matrix not initialized");
+  }
+  if (rows <= 0 || cols <= 0) {
+    throw std::invalid_argument("Rows and columns must be >0");
+  }
+  if (stride < cols) {
+    throw std::invalid_argument("Stride must be >= columns");
+  }
+}
+
+// Исключённые строка и столбец, попавшие внутрь блока, остаются
+// исключёнными; лежащие до блока уже учтены в его начальном адресе.
+S21MatrixView S21MatrixView::Block(int row, int col, int rows,
+                                   int cols) const {
+  if (rows <= 0 || cols <= 0) {
+    throw std::invalid_argument("Rows and columns must be >0");
+  }
+  if (row < 0 || col < 0 || row + rows > rows_ || col + cols > cols_) {
+    throw std::out_of_range("Index out of bounds");
+  }
+  S21MatrixView block(RowData(row) + col + (col >= excluded_col_), rows, cols,
+                      stride_, layout_);
+  if (row < excluded_row_) {
+    block.excluded_row_ = std::min(excluded_row_ - row, rows);
+  }
+  if (col < excluded_col_) {
+    block.excluded_col_ = std::min(excluded_col_ - col, cols);
+  }
+  return block;
+}
+
+S21MatrixView S21MatrixView::Minor(int excluded_row, int excluded_col) const {
+  if (excluded_row < 0 || excluded_row >= rows_ || excluded_col < 0 ||
+      excluded_col >= cols_) {
+    throw std::out_of_range("Invalid excluded row or column");
+  }
+  if (HasExclusions()) {
+    throw std::invalid_argument("View already excludes a row or column");
+  }
+  S21MatrixView minor(data_, rows_ - 1, cols_ - 1, stride_, layout_);
+  minor.excluded_row_ = excluded_row;
+  minor.excluded_col_ = excluded_col;
+  return minor;
+}
+
+double S21MatrixView::operator()(int i, int j) const {
+  if (i < 0 || i >= rows_ || j < 0 || j >= cols_) {
+    throw std::out_of_range("Index out of bounds");
+  }
+  return At(i, j);
+}
+
+S21Matrix S21MatrixView::ToMatrix() const {
+  S21Matrix result(rows_, cols_, layout_);
+  for (int i = 0; i < rows_; i++) {
+    CopyRow(*this, i, result.Row(i).data());
+  }
+  return result;
+}
+
+// Строки сравниваются не более чем тремя непрерывными отрезками: границы
+// отрезков — исключённые столбцы обоих видов.
+bool S21MatrixView::EqMatrix(const S21MatrixView &other,
+                             S21Matrix::Tolerance tolerance) const {
+  if (!std::isfinite(tolerance.value) || tolerance.value < 0.0) {
+    throw std::invalid_argument("Tolerance must be finite and >=0");
+  }
+  bool result = rows_ == other.rows_ && cols_ == other.cols_;
+  const int first = std::min(excluded_col_, other.excluded_col_);
+  const int second = std::max(excluded_col_, other.excluded_col_);
+  for (int i = 0; i < rows_ && result; i++) {
+    const double *a = RowData(i);
+    const double *b = other.RowData(i);
+    result = Within(a, b, first, tolerance);
+    if (result && second > first) {
+      result = Within(a + first + (first >= excluded_col_),
+                      b + first + (first >= other.excluded_col_),
+                      std::min(second, cols_) - first, tolerance);
+    }
+    if (result && second < cols_) {
+      result = Within(a + second + 1, b + second + 1, cols_ - second,
+                      tolerance);
+    }
+  }
+  return result;
+}
+
+// Исключённые строка и столбец делят вид не более чем на четыре
+// непрерывных блока; каждый транспонируется блочным ядром.
+S21Matrix S21MatrixView::Transpose() const {
+  S21Matrix result(cols_, rows_, layout_);
+  const int row_pieces[] = {0, excluded_row_, rows_};
+  const int col_pieces[] = {0, excluded_col_, cols_};
+  for (int r = 0; r < 2; r++) {
+    for (int c = 0; c < 2; c++) {
+      const int row = row_pieces[r];
+      const int col = col_pieces[c];
+      const int rows = row_pieces[r + 1] - row;
+      const int cols = col_pieces[c + 1] - col;
+      if (rows > 0 && cols > 0) {
+        s21::Transpose(rows, cols, RowData(row) + col + c, stride_,
+                       &result.At(col, row), result.GetStride());
+      }
+    }
+  }
+  return result;
+}
+
+S21Matrix S21MatrixView::CalcComplements() const {
+  if (rows_ != cols_) {
+    throw std::invalid_argument("Matrix must be square");
+  }
+  S21Matrix result(rows_, cols_, layout_);
+  S21Matrix inverse;
+  double det = 0.0;
+  // Для n > 3 у невырожденной матрицы дополнения равны det(A) * A^-T: одна
+  // LU-факторизация вместо n^2 определителей миноров. Численно вырожденная
+  // (ведущий элемент в пределах допуска LuFactor) считается через миноры,
+  // иначе A^-T — шум округления.
+  if (rows_ > 3 && LuInverse(inverse, &det)) {
+    for (int i = 0; i < rows_; i++) {
+      for (int j = 0; j < cols_; j++) {
+        result.At(i, j) = det * inverse.At(j, i);
+      }
+    }
+  } else {
+    // Малые и вырожденные матрицы: миноры по определению (виды без
+    // копирования), каждый определитель через LU за O(n^3), итого O(n^5).
+    for (int i = 0; i < rows_; i++) {
+      for (int j = 0; j < cols_; j++) {
+        double det = Minor(i, j).Determinant();
+        result.At(i, j) = ((i + j) % 2 == 0 ? 1 : -1) * det;
+      }
+    }
+  }
+  return result;
+}
+
+double S21MatrixView::Determinant() const {
+  if (rows_ != cols_) throw std::invalid_argument("Matrix must be square");
+  double result = 0.0;
+  if (rows_ == 1) {
+    result = At(0, 0);
+  } else if (rows_ == 2) {
+    result = At(0, 0) * At(1, 1) - At(1, 0) * At(0, 1);
+  } else if (rows_ == 3) {
+    result = At(0, 0) * (At(1, 1) * At(2, 2) - At(1, 2) * At(2, 1)) -
+             At(0, 1) * (At(1, 0) * At(2, 2) - At(1, 2) * At(2, 0)) +
+             At(0, 2) * (At(1, 0) * At(2, 1) - At(1, 1) * At(2, 0));
+  } else {
+    // det(A) = (-1)^swaps * prod(diag(U)) для PA = LU.
+    S21Matrix lu = ToMatrix();
+    int swaps = 0;
+    if (s21::LuFactor(rows_, lu.Data(), lu.GetStride(), nullptr, &swaps) ==
+        0) {
+      result = swaps % 2 == 0 ? 1.0 : -1.0;
+      for (int i = 0; i < rows_; i++) {
+        result *= lu.At(i, i);
+      }
+    }
+  }
+  return result;
+}
+
+S21Matrix S21MatrixView::InverseMatrix() const {
+  if (rows_ != cols_) throw std::invalid_argument("Matrix must be square");
+  S21Matrix result;
+  if (!LuInverse(result, nullptr)) {
+    throw std::runtime_error("Matrix is singular");
+  }
+  return result;
+}
+
+// Квадратная матрица решается через LU, высокая — по методу наименьших
+// квадратов через QR.
+S21Matrix S21MatrixView::Solve(const S21MatrixView &b) const {
+  return rows_ == cols_ ? S21Lu(*this).Solve(b) : S21Qr(*this).Solve(b);
+}
+
+// Одна факторизация PA = LU, затем решение A X = I; численно нулевой
+// ведущий элемент (см. LuFactor) означает вырожденную матрицу
+// (возвращается false).
+bool S21MatrixView::LuInverse(S21Matrix &inverse, double *det) const {
+  S21Matrix lu = ToMatrix();
+  std::vector<int> pivots(rows_);
+  int swaps = 0;
+  bool regular = s21::LuFactor(rows_, lu.Data(), lu.GetStride(),
+                               pivots.data(), &swaps) == 0;
+  if (regular) {
+    if (det != nullptr) {
+      *det = swaps % 2 == 0 ? 1.0 : -1.0;
+      for (int i = 0; i < rows_; i++) {
+        *det *= lu.At(i, i);
+      }
+    }
+    inverse = S21Matrix(rows_, cols_, layout_);
+    for (int i = 0; i < rows_; i++) {
+      inverse.At(i, i) = 1.0;
+    }
+    s21::LuSolve(rows_, lu.Data(), lu.GetStride(), pivots.data(), cols_,
+                 inverse.Data(), inverse.GetStride());
+  }
+  return regular;
+}
+
+// Вид без исключений передаётся в GEMM как есть (stride — leading
+// dimension); вид-минор сначала собирается в плотную копию.
+S21Matrix S21MatrixView::operator*(const S21MatrixView &other) const {
+  if (cols_ != other.rows_) {
+    throw std::invalid_argument("Invalid dimensions for multiplication");
+  }
+  S21Matrix packed_a;
+  S21Matrix packed_b;
+  if (HasExclusions()) packed_a = ToMatrix();
+  if (other.HasExclusions()) packed_b = other.ToMatrix();
+  const S21MatrixView a = HasExclusions() ? packed_a : *this;
+  const S21MatrixView b = other.HasExclusions() ? packed_b : other;
+  S21Matrix result(rows_, other.cols_, layout_);
+  s21::Gemm(rows_, other.cols_, cols_, 1.0, a.data_, a.stride_, b.data_,
+            b.stride_, 0.0, result.Data(), result.GetStride());
+  return result;
+}
@@ -0,0 +1,116 @@
+#ifndef S21_MATRIX_VIEW_H
+#define S21_MATRIX_VIEW_H
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+#include "s21_matrix_oop.h"
+
+// Невладеющий вид на элементы матрицы: начало, размеры, шаг строки и,
+// по желанию, одна исключённая строка и один исключённый столбец (минор).
+// Вид не копирует данные и живёт не дольше матрицы, на которую указывает;
+// все операции только читают элементы и возвращают новые S21Matrix.
+// Раскладка результатов наследуется от исходной матрицы.
+class S21MatrixView {
+ public:
+  // Вся матрица. Неявное преобразование позволяет передавать S21Matrix
+  // туда, где ожидается вид.
+  S21MatrixView(const S21Matrix &matrix);
+  // rows x cols элементов по адресу data с шагом строки stride.
+  S21MatrixView(const double *data, int rows, int cols, int stride);
+
+  // Прямоугольный блок rows x cols с левым верхним углом (row, col).
+  S21MatrixView Block(int row, int col, int rows, int cols) const;
+  // Вид без строки excluded_row и столбца excluded_col. Вид, который уже
+  // исключает строку или столбец, повторно сузить нельзя.
+  S21MatrixView Minor(int excluded_row, int excluded_col) const;
+
+  int GetRows() const noexcept { return rows_; }
+  int GetCols() const noexcept { return cols_; }
+  int GetStride() const noexcept { return stride_; }
+  S21Matrix::Layout GetLayout() const noexcept { return layout_; }
+
+  double operator()(int i, int j) const;
+  double At(int i, int j) const noexcept {
+    assert(i >= 0 && i < rows_ && j >= 0 && j < cols_);
+    return RowData(i)[j + (j >= excluded_col_)];
+  }
+  // Строка i: RowData(i)[j] для j < GetExcludedCol(), RowData(i)[j + 1]
+  // для остальных. Без исключённого столбца GetExcludedCol() == GetCols().
+  const double *RowData(int i) const noexcept {
+    assert(i >= 0 && i < rows_);
+    return data_ + static_cast<std::ptrdiff_t>(i + (i >= excluded_row_)) *
+                       stride_;
+  }
+  int GetExcludedCol() const noexcept { return excluded_col_; }
+  // false — строки вида лежат с постоянным шагом GetStride() от RowData(0).
+  bool HasExclusions() const noexcept {
+    return excluded_row_ < rows_ || excluded_col_ < cols_;
+  }
+
+  S21Matrix ToMatrix() const;
+  // Строки сравниваются векторно и до первого несовпадения.
+  bool EqMatrix(const S21MatrixView &other,
+                S21Matrix::Tolerance tolerance =
+                    S21Matrix::kDefaultTolerance) const;
+  S21Matrix Transpose() const;
+  S21Matrix CalcComplements() const;
+  double Determinant() const;
+  S21Matrix InverseMatrix() const;
+  // X из A X = B без обращения A: одна факторизация LU на все столбцы B.
+  // Для A m x n с m > n — решение по методу наименьших квадратов через
+  // QR. Для повторных решений с той же A см. S21Lu (s21_lu.h) и S21Qr.
+  S21Matrix Solve(const S21MatrixView &b) const;
+  S21Matrix operator*(const S21MatrixView &other) const;
+
+ private:
+  S21MatrixView(const double *data, int rows, int cols, int stride,
+                S21Matrix::Layout layout);
+  bool LuInverse(S21Matrix &inverse, double *det) const;
+
+  const double *data_;
+  int rows_, cols_;
+  int stride_;
+  // Логические индексы >= excluded_* сдвигаются на единицу; значение,
+  // равное rows_/cols_, означает «ничего не исключено».
+  int excluded_row_, excluded_col_;
+  S21Matrix::Layout layout_;
+};
+
+namespace s21 {
+
+// Строка вида: элементы после исключённого столбца сдвинуты на один.
+struct ViewRow {
+  const double *row;
+  int split;
+  double Load(int j, std::uint64_t &) const {
+    return row[j + (j >= split)];
+  }
+};
+
+// Вид как операнд ленивых поэлементных выражений.
+class MatrixViewRef : public MatrixExpr<MatrixViewRef> {
+ public:
+  explicit MatrixViewRef(const S21MatrixView &view) : view_(view) {}
+  static constexpr bool kChecksOperands = false;
+  int GetRows() const { return view_.GetRows(); }
+  int GetCols() const { return view_.GetCols(); }
+  S21Matrix::Layout GetLayout() const { return view_.GetLayout(); }
+  // Без исключённого столбца split == GetCols() и строка читается подряд.
+  ViewRow Row(int i) const {
+    return {view_.RowData(i), view_.GetExcludedCol()};
+  }
+  S21Matrix *Reusable(S21Matrix::Layout) { return nullptr; }
+
+ private:
+  S21MatrixView view_;
+};
+
+inline MatrixViewRef Wrap(const S21MatrixView &view) {
+  return MatrixViewRef(view);
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,248 @@
+#include "s21_qr.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+
+namespace {
+
+double *Row(double *a, int lda, int i) {
+  return a + static_cast<std::size_t>(i) * lda;
+}
+
+const double *Row(const double *a, int lda, int i) {
+  return a + static_cast<std::size_t>(i) * lda;
+}
+
+// Отражения столбцов [j0, j1) на строках [j0, m) по одному; каждое сразу
+// применяется к оставшимся столбцам панели. Вектор v = (1, a[j+1..m, j]),
+// H = I - tau v v^T. Строки обходятся целиком, поэтому доступ к памяти
+// непрерывный, хотя векторы лежат в столбцах.
+void FactorPanel(int m, int j0, int j1, double *a, int lda, double *tau) {
+  std::vector<double> w(j1 - j0);
+  for (int j = j0; j < j1; j++) {
+    double norm2 = 0.0;
+    for (int r = j + 1; r < m; r++) {
+      norm2 += Row(a, lda, r)[j] * Row(a, lda, r)[j];
+    }
+    tau[j - j0] = 0.0;
+    if (norm2 == 0.0) continue;
+    const double alpha = Row(a, lda, j)[j];
+    const double beta = -std::copysign(std::sqrt(alpha * alpha + norm2), alpha);
+    const double scale = 1.0 / (alpha - beta);
+    for (int r = j + 1; r < m; r++) Row(a, lda, r)[j] *= scale;
+    Row(a, lda, j)[j] = beta;
+    const double t = (beta - alpha) / beta;
+    tau[j - j0] = t;
+    // w = v^T A[j.., j+1..j1), затем A -= tau v w.
+    const int cols = j1 - j - 1;
+    if (cols == 0) continue;
+    std::copy_n(Row(a, lda, j) + j + 1, cols, w.begin());
+    for (int r = j + 1; r < m; r++) {
+      const double *row = Row(a, lda, r);
+      for (int c = 0; c < cols; c++) w[c] += row[j] * row[j + 1 + c];
+    }
+    for (int c = 0; c < cols; c++) Row(a, lda, j)[j + 1 + c] -= t * w[c];
+    for (int r = j + 1; r < m; r++) {
+      double *row = Row(a, lda, r);
+      const double v = t * row[j];
+      for (int c = 0; c < cols; c++) row[j + 1 + c] -= v * w[c];
+    }
+  }
+}
+
+// Единичная нижнетреугольная V1 — первые nb строк векторов блока,
+// плотной копией для Gemm.
+std::vector<double> PackV1(int nb, const double *v, int ldv) {
+  std::vector<double> v1(static_cast<std::size_t>(nb) * nb, 0.0);
+  for (int i = 0; i < nb; i++) {
+    std::copy_n(Row(v, ldv, i), i, &v1[static_cast<std::size_t>(i) * nb]);
+    v1[static_cast<std::size_t>(i) * nb + i] = 1.0;
+  }
+  return v1;
+}
+
+// T блока (как dlarft, forward columnwise): T_ii = tau_i,
+// T[0..i), i] = -tau_i T[0..i), 0..i)) V^T v_i; V^T V считается двумя
+// вызовами Gemm — для V1 и для лежащей в матрице V2.
+void BuildT(int rows, int nb, const double *v, int ldv, const double *tau,
+            double *t, int ldt) {
+  const std::vector<double> v1 = PackV1(nb, v, ldv);
+  std::vector<double> g(static_cast<std::size_t>(nb) * nb);
+  Gemm(Trans::kYes, Trans::kNo, nb, nb, nb, 1.0, v1.data(), nb, v1.data(),
+       nb, 0.0, g.data(), nb);
+  if (rows > nb) {
+    Gemm(Trans::kYes, Trans::kNo, nb, nb, rows - nb, 1.0, Row(v, ldv, nb),
+         ldv, Row(v, ldv, nb), ldv, 1.0, g.data(), nb);
+  }
+  for (int i = 0; i < nb; i++) {
+    for (int p = 0; p < i; p++) {
+      double sum = 0.0;
+      for (int q = p; q < i; q++) {
+        sum += Row(t, ldt, p)[q] * g[static_cast<std::size_t>(q) * nb + i];
+      }
+      Row(t, ldt, p)[i] = -tau[i] * sum;
+    }
+    Row(t, ldt, i)[i] = tau[i];
+    for (int p = i + 1; p < nb; p++) Row(t, ldt, p)[i] = 0.0;
+  }
+}
+
+// C = (I - V op(T) V^T) C для блока из nb отражений на rows строках:
+// W = V^T C, W = op(T) W, C -= V W. V1 берётся плотной копией, V2 — прямо
+// из матрицы.
+void ApplyBlock(Trans trans_t, int rows, int nb, const double *v, int ldv,
+                const double *t, int ldt, int nc, double *c, int ldc) {
+  const std::vector<double> v1 = PackV1(nb, v, ldv);
+  const std::size_t size = static_cast<std::size_t>(nb) * nc;
+  std::vector<double> w(size), tw(size);
+  Gemm(Trans::kYes, Trans::kNo, nb, nc, nb, 1.0, v1.data(), nb, c, ldc, 0.0,
+       w.data(), nc);
+  if (rows > nb) {
+    Gemm(Trans::kYes, Trans::kNo, nb, nc, rows - nb, 1.0, Row(v, ldv, nb), ldv,
+         Row(c, ldc, nb), ldc, 1.0, w.data(), nc);
+  }
+  Gemm(trans_t, Trans::kNo, nb, nc, nb, 1.0, t, ldt, w.data(), nc, 0.0,
+       tw.data(), nc);
+  Gemm(nb, nc, nb, -1.0, v1.data(), nb, tw.data(), nc, 1.0, c, ldc);
+  if (rows > nb) {
+    Gemm(rows - nb, nc, nb, -1.0, Row(v, ldv, nb), ldv, tw.data(), nc, 1.0,
+         Row(c, ldc, nb), ldc);
+  }
+}
+
+}  // namespace
+
+// Панель раскладывается отражениями по одному, затем её T собирается
+// из V^T V, и остаток матрицы обновляется блоком Q^T через Gemm.
+void QrFactor(int m, int n, double *a, int lda, double *t) {
+  std::vector<double> tau(kQrBlock);
+  for (int j0 = 0; j0 < n; j0 += kQrBlock) {
+    const int j1 = std::min(n, j0 + kQrBlock);
+    const int nb = j1 - j0;
+    double *v = Row(a, lda, j0) + j0;
+    FactorPanel(m, j0, j1, a, lda, tau.data());
+    BuildT(m - j0, nb, v, lda, tau.data(), t + j0, n);
+    if (j1 < n) {
+      ApplyBlock(Trans::kYes, m - j0, nb, v, lda, t + j0, n, n - j1, v + nb,
+                 lda);
+    }
+  }
+}
+
+// Q^T = Q_K^T ... Q_1^T применяется блоками по порядку, Q — в обратном.
+void QrApplyQ(Trans trans, int m, int n, const double *qr, int ldqr,
+              const double *t, int nrhs, double *c, int ldc) {
+  const int blocks = (n + kQrBlock - 1) / kQrBlock;
+  for (int k = 0; k < blocks; k++) {
+    const int j0 = (trans == Trans::kYes ? k : blocks - 1 - k) * kQrBlock;
+    const int nb = std::min(n, j0 + kQrBlock) - j0;
+    ApplyBlock(trans == Trans::kYes ? Trans::kYes : Trans::kNo, m - j0, nb,
+               Row(qr, ldqr, j0) + j0, ldqr, t + j0, n, nrhs, Row(c, ldc, j0),
+               ldc);
+  }
+}
+
+// R X = (Q^T B)[0..n): блоки строк снизу вверх, как обратный ход LU.
+void QrSolve(int m, int n, const double *qr, int ldqr, const double *t,
+             int nrhs, double *b, int ldb) {
+  QrApplyQ(Trans::kYes, m, n, qr, ldqr, t, nrhs, b, ldb);
+  for (int i1 = n; i1 > 0; i1 -= kQrBlock) {
+    const int i0 = std::max(0, i1 - kQrBlock);
+    if (i1 < n) {
+      Gemm(i1 - i0, nrhs, n - i1, -1.0, Row(qr, ldqr, i0) + i1, ldqr,
+           Row(b, ldb, i1), ldb, 1.0, Row(b, ldb, i0), ldb);
+    }
+    for (int i = i1 - 1; i >= i0; i--) {
+      double *row = Row(b, ldb, i);
+      const double *r = Row(qr, ldqr, i);
+      for (int p = i + 1; p < i1; p++) {
+        const double *src = Row(b, ldb, p);
+        for (int j = 0; j < nrhs; j++) {
+          row[j] -= r[p] * src[j];
+        }
+      }
+      const double inv = 1.0 / r[i];
+      for (int j = 0; j < nrhs; j++) {
+        row[j] *= inv;
+      }
+    }
+  }
+}
+
+}  // namespace s21
+
+S21Qr::S21Qr(const S21MatrixView &matrix) : factor_(matrix.ToMatrix()) {
+  Factor();
+}
+
+S21Qr::S21Qr(S21Matrix &&matrix) : factor_(std::move(matrix)) {
+  if (factor_.Data() == nullptr) {
+    throw std::runtime_error("Matrix not initialized");
+  }
+  Factor();
+}
+
+void S21Qr::Factor() {
+  const int m = factor_.GetRows();
+  const int n = factor_.GetCols();
+  if (m < n) {
+    throw std::invalid_argument(
+        "Matrix must have at least as many rows as columns");
+  }
+  t_.assign(static_cast<std::size_t>(s21::kQrBlock) * n, 0.0);
+  s21::QrFactor(m, n, factor_.Data(), factor_.GetStride(), t_.data());
+  double largest = 0.0;
+  for (int i = 0; i < n; i++) {
+    largest = std::max(largest, std::fabs(factor_.At(i, i)));
+  }
+  const double threshold =
+      largest * m * std::numeric_limits<double>::epsilon();
+  for (int i = 0; i < n; i++) {
+    if (std::fabs(factor_.At(i, i)) <= threshold) full_rank_ = false;
+  }
+}
+
+S21Matrix S21Qr::GetQ() const {
+  const int m = factor_.GetRows();
+  const int n = factor_.GetCols();
+  S21Matrix result(m, n, factor_.GetLayout());
+  for (int i = 0; i < n; i++) {
+    result.At(i, i) = 1.0;
+  }
+  s21::QrApplyQ(s21::Trans::kNo, m, n, factor_.Data(), factor_.GetStride(),
+                t_.data(), n, result.Data(), result.GetStride());
+  return result;
+}
+
+S21Matrix S21Qr::GetR() const {
+  const int n = factor_.GetCols();
+  S21Matrix result(n, n, factor_.GetLayout());
+  for (int i = 0; i < n; i++) {
+    std::copy(factor_.Row(i).begin() + i, factor_.Row(i).end(),
+              result.Row(i).begin() + i);
+  }
+  return result;
+}
+
+S21Matrix S21Qr::Solve(const S21MatrixView &b) const {
+  const int m = factor_.GetRows();
+  const int n = factor_.GetCols();
+  if (b.GetRows() != m) {
+    throw std::invalid_argument("Invalid dimensions for solve");
+  }
+  if (!full_rank_) throw std::runtime_error("Matrix is rank deficient");
+  S21Matrix work = b.ToMatrix();
+  s21::QrSolve(m, n, factor_.Data(), factor_.GetStride(), t_.data(),
+               work.GetCols(), work.Data(), work.GetStride());
+  S21Matrix result(n, work.GetCols(), work.GetLayout());
+  for (int i = 0; i < n; i++) {
+    std::copy(work.Row(i).begin(), work.Row(i).end(), result.Row(i).begin());
+  }
+  return result;
+}
@@ -0,0 +1,68 @@
+#ifndef S21_QR_H
+#define S21_QR_H
+
+#include <vector>
+
+#include "s21_gemm.h"
+#include "s21_matrix_oop.h"
+
+namespace s21 {
+
+// Ширина блока отражений: блок из kQrBlock отражений Хаусхолдера
+// H_j0 ... H_j1-1 хранится в компактной форме WY как I - V T V^T.
+constexpr int kQrBlock = 64;
+
+// Факторизация A = QR на месте для row-major матрицы m x n (m >= n) с
+// шагом строк lda. После вызова на диагонали и выше лежит R, под
+// диагональю — векторы отражений V (единичный первый элемент не
+// хранится). t — row-major kQrBlock x n с шагом n: верхнетреугольная
+// T блока столбцов [j0, j1) занимает строки [0, j1 - j0) столбцов
+// [j0, j1), на её диагонали — коэффициенты tau отражений.
+void QrFactor(int m, int n, double *a, int lda, double *t);
+
+// C = op(Q) C по результату QrFactor, где op(Q) = Q или Q^T по флагу:
+// C — row-major m x nrhs с шагом ldc.
+void QrApplyQ(Trans trans, int m, int n, const double *qr, int ldqr,
+              const double *t, int nrhs, double *c, int ldc);
+
+// Решение по методу наименьших квадратов min ||A X - B|| по результату
+// QrFactor (R невырождена): B — row-major m x nrhs с шагом ldb,
+// решение X записывается в первые n строк B, остальные строки
+// получают Q^T B (их норма — невязка).
+void QrSolve(int m, int n, const double *qr, int ldqr, const double *t,
+             int nrhs, double *b, int ldb);
+
+}  // namespace s21
+
+// Блочное разложение Хаусхолдера A = QR матрицы m x n с m >= n: Q —
+// ортогональная (хранится отражениями), R — верхнетреугольная n x n.
+// Solve решает переопределённые системы по методу наименьших квадратов
+// без нормальных уравнений A^T A, которые возводят число обусловленности
+// в квадрат.
+class S21Qr {
+ public:
+  explicit S21Qr(const S21MatrixView &matrix);
+  // Раскладывает матрицу в её же буфере, без копии.
+  explicit S21Qr(S21Matrix &&matrix);
+
+  // Q с n ортонормированными столбцами (экономная форма, m x n).
+  S21Matrix GetQ() const;
+  // Верхнетреугольная R, n x n.
+  S21Matrix GetR() const;
+  // false, если какой-то |R_ii| не больше max|R_jj| * m * eps: столбцы A
+  // линейно зависимы в пределах точности.
+  bool IsFullRank() const noexcept { return full_rank_; }
+
+  // X (n x k), минимизирующая ||A X - B|| для B m x k; бросает
+  // std::runtime_error для неполного ранга.
+  S21Matrix Solve(const S21MatrixView &b) const;
+
+ private:
+  void Factor();
+
+  S21Matrix factor_;
+  std::vector<double> t_;
+  bool full_rank_ = true;
+};
+
+#endif
@@ -0,0 +1,563 @@
+#include "s21_simd.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define S21_SIMD_X86 1
+#endif
+
+namespace s21::simd {
+
+namespace {
+
+struct Kernels {
+  bool (*add_scaled)(double *, const double *, double, int);
+  double (*dot)(const double *, const double *, int);
+  void (*scale)(double *, double, int);
+  bool (*within_tolerance)(const double *, const double *, double, int);
+  bool (*within_relative)(const double *, const double *, double, int);
+  bool (*within_ulps)(const double *, const double *, std::uint64_t, int);
+};
+
+// Скалярные ядра: хвосты векторных версий и запасной вариант.
+
+bool AddScaledScalar(double *a, const double *b, double sign, int n) {
+  bool finite = true;
+  for (int j = 0; j < n; j++) {
+    finite &= std::isfinite(a[j]) && std::isfinite(b[j]);
+    a[j] += sign * b[j];
+  }
+  return finite;
+}
+
+double DotScalar(const double *a, const double *b, int n) {
+  double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+  int j = 0;
+  for (; j + 4 <= n; j += 4) {
+    s0 += a[j] * b[j];
+    s1 += a[j + 1] * b[j + 1];
+    s2 += a[j + 2] * b[j + 2];
+    s3 += a[j + 3] * b[j + 3];
+  }
+  for (; j < n; j++) s0 += a[j] * b[j];
+  return (s0 + s1) + (s2 + s3);
+}
+
+void ScaleScalar(double *a, double num, int n) {
+  for (int j = 0; j < n; j++) {
+    a[j] *= num;
+  }
+}
+
+bool WithinToleranceScalar(const double *a, const double *b, double tolerance,
+                           int n) {
+  for (int j = 0; j < n; j++) {
+    if (std::abs(a[j] - b[j]) > tolerance) return false;
+  }
+  return true;
+}
+
+bool WithinRelativeScalar(const double *a, const double *b, double tolerance,
+                          int n) {
+  for (int j = 0; j < n; j++) {
+    const double scale = std::max(std::abs(a[j]), std::abs(b[j]));
+    if (!(a[j] == b[j] || std::abs(a[j] - b[j]) <= tolerance * scale)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Биты double как целое, монотонное по значению: отрицательные числа
+// отражаются, -0 и +0 дают 0. Соседние double отличаются на 1.
+std::int64_t OrderedBits(double x) {
+  std::int64_t bits;
+  std::memcpy(&bits, &x, sizeof(bits));
+  return bits < 0 ? std::numeric_limits<std::int64_t>::min() - bits : bits;
+}
+
+bool WithinUlpsScalar(const double *a, const double *b, std::uint64_t ulps,
+                      int n) {
+  for (int j = 0; j < n; j++) {
+    if (a[j] == b[j]) continue;
+    const std::int64_t x = OrderedBits(a[j]);
+    const std::int64_t y = OrderedBits(b[j]);
+    // Расстояние считается без знака: разность крайних значений не
+    // помещается в int64.
+    const std::uint64_t distance =
+        x > y ? static_cast<std::uint64_t>(x) - static_cast<std::uint64_t>(y)
+              : static_cast<std::uint64_t>(y) - static_cast<std::uint64_t>(x);
+    if (std::isnan(a[j]) || std::isnan(b[j]) ||
+        distance > ulps) {
+      return false;
+    }
+  }
+  return true;
+}
+
+#ifdef S21_SIMD_X86
+
+// Как и у AVX2/AVX-512, набор задан атрибутом target: на i386 без -msse2
+// базовый набор SSE2 не включает.
+
+// Признак «не конечно»: |x| > DBL_MAX или NaN (неупорядоченное сравнение).
+
+__attribute__((target("sse2"))) bool AddScaledSse2(double *a, const double *b,
+                                                   double sign, int n) {
+  const __m128d vsign = _mm_set1_pd(sign);
+  const __m128d vmax = _mm_set1_pd(DBL_MAX);
+  const __m128d abs_mask =
+      _mm_castsi128_pd(_mm_set1_epi64x(0x7fffffffffffffffLL));
+  __m128d bad = _mm_setzero_pd();
+  int j = 0;
+  for (; j + 2 <= n; j += 2) {
+    const __m128d va = _mm_loadu_pd(a + j);
+    const __m128d vb = _mm_loadu_pd(b + j);
+    bad = _mm_or_pd(bad, _mm_cmpnle_pd(_mm_and_pd(va, abs_mask), vmax));
+    bad = _mm_or_pd(bad, _mm_cmpnle_pd(_mm_and_pd(vb, abs_mask), vmax));
+    _mm_storeu_pd(a + j, _mm_add_pd(va, _mm_mul_pd(vsign, vb)));
+  }
+  const bool tail = AddScaledScalar(a + j, b + j, sign, n - j);
+  return _mm_movemask_pd(bad) == 0 && tail;
+}
+
+// Четыре аккумулятора скрывают задержку сложения.
+__attribute__((target("sse2"))) double DotSse2(const double *a, const double *b,
+                                               int n) {
+  __m128d s0 = _mm_setzero_pd(), s1 = _mm_setzero_pd();
+  __m128d s2 = _mm_setzero_pd(), s3 = _mm_setzero_pd();
+  int j = 0;
+  for (; j + 8 <= n; j += 8) {
+    s0 = _mm_add_pd(s0, _mm_mul_pd(_mm_loadu_pd(a + j), _mm_loadu_pd(b + j)));
+    s1 = _mm_add_pd(
+        s1, _mm_mul_pd(_mm_loadu_pd(a + j + 2), _mm_loadu_pd(b + j + 2)));
+    s2 = _mm_add_pd(
+        s2, _mm_mul_pd(_mm_loadu_pd(a + j + 4), _mm_loadu_pd(b + j + 4)));
+    s3 = _mm_add_pd(
+        s3, _mm_mul_pd(_mm_loadu_pd(a + j + 6), _mm_loadu_pd(b + j + 6)));
+  }
+  const __m128d sum = _mm_add_pd(_mm_add_pd(s0, s1), _mm_add_pd(s2, s3));
+  return _mm_cvtsd_f64(sum) + _mm_cvtsd_f64(_mm_unpackhi_pd(sum, sum)) +
+         DotScalar(a + j, b + j, n - j);
+}
+
+__attribute__((target("sse2"))) void ScaleSse2(double *a, double num, int n) {
+  const __m128d vnum = _mm_set1_pd(num);
+  int j = 0;
+  for (; j + 2 <= n; j += 2) {
+    _mm_storeu_pd(a + j, _mm_mul_pd(_mm_loadu_pd(a + j), vnum));
+  }
+  ScaleScalar(a + j, num, n - j);
+}
+
+__attribute__((target("sse2"))) bool WithinToleranceSse2(const double *a,
+                                                         const double *b,
+                                                         double tolerance,
+                                                         int n) {
+  const __m128d vtol = _mm_set1_pd(tolerance);
+  const __m128d abs_mask =
+      _mm_castsi128_pd(_mm_set1_epi64x(0x7fffffffffffffffLL));
+  int j = 0;
+  for (; j + 2 <= n; j += 2) {
+    const __m128d diff = _mm_sub_pd(_mm_loadu_pd(a + j), _mm_loadu_pd(b + j));
+    if (_mm_movemask_pd(_mm_cmpgt_pd(_mm_and_pd(diff, abs_mask), vtol)) != 0) {
+      return false;
+    }
+  }
+  return WithinToleranceScalar(a + j, b + j, tolerance, n - j);
+}
+
+__attribute__((target("sse2"))) bool WithinRelativeSse2(const double *a,
+                                                        const double *b,
+                                                        double tolerance,
+                                                        int n) {
+  const __m128d vtol = _mm_set1_pd(tolerance);
+  const __m128d abs_mask =
+      _mm_castsi128_pd(_mm_set1_epi64x(0x7fffffffffffffffLL));
+  int j = 0;
+  for (; j + 2 <= n; j += 2) {
+    const __m128d va = _mm_loadu_pd(a + j);
+    const __m128d vb = _mm_loadu_pd(b + j);
+    const __m128d diff = _mm_and_pd(_mm_sub_pd(va, vb), abs_mask);
+    const __m128d scale = _mm_mul_pd(
+        vtol, _mm_max_pd(_mm_and_pd(va, abs_mask), _mm_and_pd(vb, abs_mask)));
+    const __m128d ok =
+        _mm_or_pd(_mm_cmpeq_pd(va, vb), _mm_cmple_pd(diff, scale));
+    if (_mm_movemask_pd(ok) != 0x3) return false;
+  }
+  return WithinRelativeScalar(a + j, b + j, tolerance, n - j);
+}
+
+__attribute__((target("avx2"))) bool AddScaledAvx2(double *a, const double *b,
+                                                   double sign, int n) {
+  const __m256d vsign = _mm256_set1_pd(sign);
+  const __m256d vmax = _mm256_set1_pd(DBL_MAX);
+  const __m256d abs_mask =
+      _mm256_castsi256_pd(_mm256_set1_epi64x(0x7fffffffffffffffLL));
+  __m256d bad = _mm256_setzero_pd();
+  int j = 0;
+  for (; j + 4 <= n; j += 4) {
+    const __m256d va = _mm256_loadu_pd(a + j);
+    const __m256d vb = _mm256_loadu_pd(b + j);
+    bad = _mm256_or_pd(
+        bad, _mm256_cmp_pd(_mm256_and_pd(va, abs_mask), vmax, _CMP_NLE_UQ));
+    bad = _mm256_or_pd(
+        bad, _mm256_cmp_pd(_mm256_and_pd(vb, abs_mask), vmax, _CMP_NLE_UQ));
+    _mm256_storeu_pd(a + j, _mm256_add_pd(va, _mm256_mul_pd(vsign, vb)));
+  }
+  const bool tail = AddScaledScalar(a + j, b + j, sign, n - j);
+  return _mm256_movemask_pd(bad) == 0 && tail;
+}
+
+__attribute__((target("avx2"))) double DotAvx2(const double *a,
+                                                const double *b, int n) {
+  __m256d s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd();
+  __m256d s2 = _mm256_setzero_pd(), s3 = _mm256_setzero_pd();
+  int j = 0;
+  for (; j + 16 <= n; j += 16) {
+    s0 = _mm256_add_pd(
+        s0, _mm256_mul_pd(_mm256_loadu_pd(a + j), _mm256_loadu_pd(b + j)));
+    s1 = _mm256_add_pd(s1, _mm256_mul_pd(_mm256_loadu_pd(a + j + 4),
+                                         _mm256_loadu_pd(b + j + 4)));
+    s2 = _mm256_add_pd(s2, _mm256_mul_pd(_mm256_loadu_pd(a + j + 8),
+                                         _mm256_loadu_pd(b + j + 8)));
+    s3 = _mm256_add_pd(s3, _mm256_mul_pd(_mm256_loadu_pd(a + j + 12),
+                                         _mm256_loadu_pd(b + j + 12)));
+  }
+  const __m256d sum4 =
+      _mm256_add_pd(_mm256_add_pd(s0, s1), _mm256_add_pd(s2, s3));
+  const __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(sum4),
+                                 _mm256_extractf128_pd(sum4, 1));
+  return _mm_cvtsd_f64(sum) + _mm_cvtsd_f64(_mm_unpackhi_pd(sum, sum)) +
+         DotScalar(a + j, b + j, n - j);
+}
+
+__attribute__((target("avx2"))) void ScaleAvx2(double *a, double num, int n) {
+  const __m256d vnum = _mm256_set1_pd(num);
+  int j = 0;
+  for (; j + 4 <= n; j += 4) {
+    _mm256_storeu_pd(a + j, _mm256_mul_pd(_mm256_loadu_pd(a + j), vnum));
+  }
+  ScaleScalar(a + j, num, n - j);
+}
+
+__attribute__((target("avx2"))) bool WithinToleranceAvx2(const double *a,
+                                                         const double *b,
+                                                         double tolerance,
+                                                         int n) {
+  const __m256d vtol = _mm256_set1_pd(tolerance);
+  const __m256d abs_mask =
+      _mm256_castsi256_pd(_mm256_set1_epi64x(0x7fffffffffffffffLL));
+  int j = 0;
+  for (; j + 4 <= n; j += 4) {
+    const __m256d diff =
+        _mm256_sub_pd(_mm256_loadu_pd(a + j), _mm256_loadu_pd(b + j));
+    const __m256d over =
+        _mm256_cmp_pd(_mm256_and_pd(diff, abs_mask), vtol, _CMP_GT_OQ);
+    if (_mm256_movemask_pd(over) != 0) return false;
+  }
+  return WithinToleranceScalar(a + j, b + j, tolerance, n - j);
+}
+
+__attribute__((target("avx2"))) bool WithinRelativeAvx2(const double *a,
+                                                        const double *b,
+                                                        double tolerance,
+                                                        int n) {
+  const __m256d vtol = _mm256_set1_pd(tolerance);
+  const __m256d abs_mask =
+      _mm256_castsi256_pd(_mm256_set1_epi64x(0x7fffffffffffffffLL));
+  int j = 0;
+  for (; j + 4 <= n; j += 4) {
+    const __m256d va = _mm256_loadu_pd(a + j);
+    const __m256d vb = _mm256_loadu_pd(b + j);
+    const __m256d diff = _mm256_and_pd(_mm256_sub_pd(va, vb), abs_mask);
+    const __m256d scale =
+        _mm256_mul_pd(vtol, _mm256_max_pd(_mm256_and_pd(va, abs_mask),
+                                          _mm256_and_pd(vb, abs_mask)));
+    const __m256d ok = _mm256_or_pd(_mm256_cmp_pd(va, vb, _CMP_EQ_OQ),
+                                    _mm256_cmp_pd(diff, scale, _CMP_LE_OQ));
+    if (_mm256_movemask_pd(ok) != 0xf) return false;
+  }
+  return WithinRelativeScalar(a + j, b + j, tolerance, n - j);
+}
+
+// OrderedBits для четырёх чисел.
+__attribute__((target("avx2"))) __m256i OrderedBitsAvx2(__m256d v) {
+  const __m256i sign = _mm256_set1_epi64x(std::numeric_limits<int64_t>::min());
+  const __m256i bits = _mm256_castpd_si256(v);
+  const __m256i negative = _mm256_cmpgt_epi64(_mm256_setzero_si256(), bits);
+  return _mm256_blendv_epi8(bits, _mm256_sub_epi64(sign, bits), negative);
+}
+
+// В AVX2 нет беззнакового сравнения 64-битных целых: расстояние и порог
+// сдвигаются на 2^63 и сравниваются со знаком.
+__attribute__((target("avx2"))) bool WithinUlpsAvx2(const double *a,
+                                                    const double *b,
+                                                    std::uint64_t ulps, int n) {
+  const __m256i sign = _mm256_set1_epi64x(std::numeric_limits<int64_t>::min());
+  const __m256i limit = _mm256_xor_si256(
+      _mm256_set1_epi64x(static_cast<long long>(ulps)), sign);
+  int j = 0;
+  for (; j + 4 <= n; j += 4) {
+    const __m256d va = _mm256_loadu_pd(a + j);
+    const __m256d vb = _mm256_loadu_pd(b + j);
+    const __m256i x = OrderedBitsAvx2(va);
+    const __m256i y = OrderedBitsAvx2(vb);
+    const __m256i x_greater = _mm256_cmpgt_epi64(x, y);
+    const __m256i distance =
+        _mm256_blendv_epi8(_mm256_sub_epi64(y, x), _mm256_sub_epi64(x, y),
+                           x_greater);
+    const __m256i far =
+        _mm256_cmpgt_epi64(_mm256_xor_si256(distance, sign), limit);
+    const __m256d nan = _mm256_cmp_pd(va, vb, _CMP_UNORD_Q);
+    if (_mm256_movemask_pd(_mm256_or_pd(_mm256_castsi256_pd(far), nan)) != 0) {
+      return false;
+    }
+  }
+  return WithinUlpsScalar(a + j, b + j, ulps, n - j);
+}
+
+__attribute__((target("avx512f"))) bool AddScaledAvx512(double *a,
+                                                        const double *b,
+                                                        double sign, int n) {
+  const __m512d vsign = _mm512_set1_pd(sign);
+  const __m512d vmax = _mm512_set1_pd(DBL_MAX);
+  __mmask8 bad = 0;
+  int j = 0;
+  for (; j + 8 <= n; j += 8) {
+    const __m512d va = _mm512_loadu_pd(a + j);
+    const __m512d vb = _mm512_loadu_pd(b + j);
+    bad |= _mm512_cmp_pd_mask(_mm512_abs_pd(va), vmax, _CMP_NLE_UQ);
+    bad |= _mm512_cmp_pd_mask(_mm512_abs_pd(vb), vmax, _CMP_NLE_UQ);
+    _mm512_storeu_pd(a + j, _mm512_add_pd(va, _mm512_mul_pd(vsign, vb)));
+  }
+  const bool tail = AddScaledScalar(a + j, b + j, sign, n - j);
+  return bad == 0 && tail;
+}
+
+__attribute__((target("avx512f"))) double DotAvx512(const double *a,
+                                                    const double *b, int n) {
+  __m512d s0 = _mm512_setzero_pd(), s1 = _mm512_setzero_pd();
+  __m512d s2 = _mm512_setzero_pd(), s3 = _mm512_setzero_pd();
+  int j = 0;
+  for (; j + 32 <= n; j += 32) {
+    s0 = _mm512_fmadd_pd(_mm512_loadu_pd(a + j), _mm512_loadu_pd(b + j), s0);
+    s1 = _mm512_fmadd_pd(_mm512_loadu_pd(a + j + 8), _mm512_loadu_pd(b + j + 8),
+                         s1);
+    s2 = _mm512_fmadd_pd(_mm512_loadu_pd(a + j + 16),
+                         _mm512_loadu_pd(b + j + 16), s2);
+    s3 = _mm512_fmadd_pd(_mm512_loadu_pd(a + j + 24),
+                         _mm512_loadu_pd(b + j + 24), s3);
+  }
+  for (; j + 8 <= n; j += 8) {
+    s0 = _mm512_fmadd_pd(_mm512_loadu_pd(a + j), _mm512_loadu_pd(b + j), s0);
+  }
+  const __m512d sum =
+      _mm512_add_pd(_mm512_add_pd(s0, s1), _mm512_add_pd(s2, s3));
+  return _mm512_reduce_add_pd(sum) + DotScalar(a + j, b + j, n - j);
+}
+
+__attribute__((target("avx512f"))) void ScaleAvx512(double *a, double num,
+                                                    int n) {
+  const __m512d vnum = _mm512_set1_pd(num);
+  int j = 0;
+  for (; j + 8 <= n; j += 8) {
+    _mm512_storeu_pd(a + j, _mm512_mul_pd(_mm512_loadu_pd(a + j), vnum));
+  }
+  ScaleScalar(a + j, num, n - j);
+}
+
+__attribute__((target("avx512f"))) bool WithinToleranceAvx512(
+    const double *a, const double *b, double tolerance, int n) {
+  const __m512d vtol = _mm512_set1_pd(tolerance);
+  int j = 0;
+  for (; j + 8 <= n; j += 8) {
+    const __m512d diff =
+        _mm512_sub_pd(_mm512_loadu_pd(a + j), _mm512_loadu_pd(b + j));
+    if (_mm512_cmp_pd_mask(_mm512_abs_pd(diff), vtol, _CMP_GT_OQ) != 0) {
+      return false;
+    }
+  }
+  return WithinToleranceScalar(a + j, b + j, tolerance, n - j);
+}
+
+__attribute__((target("avx512f"))) bool WithinRelativeAvx512(
+    const double *a, const double *b, double tolerance, int n) {
+  const __m512d vtol = _mm512_set1_pd(tolerance);
+  int j = 0;
+  for (; j + 8 <= n; j += 8) {
+    const __m512d va = _mm512_loadu_pd(a + j);
+    const __m512d vb = _mm512_loadu_pd(b + j);
+    const __m512d diff = _mm512_abs_pd(_mm512_sub_pd(va, vb));
+    const __m512d abs_a = _mm512_abs_pd(va);
+    const __m512d abs_b = _mm512_abs_pd(vb);
+    const __m512d larger = _mm512_mask_blend_pd(
+        _mm512_cmp_pd_mask(abs_a, abs_b, _CMP_LT_OQ), abs_a, abs_b);
+    const __m512d scale = _mm512_mul_pd(vtol, larger);
+    const __mmask8 ok = _mm512_cmp_pd_mask(va, vb, _CMP_EQ_OQ) |
+                        _mm512_cmp_pd_mask(diff, scale, _CMP_LE_OQ);
+    if (ok != 0xff) return false;
+  }
+  return WithinRelativeScalar(a + j, b + j, tolerance, n - j);
+}
+
+__attribute__((target("avx512f"))) __m512i OrderedBitsAvx512(__m512d v) {
+  const __m512i sign = _mm512_set1_epi64(std::numeric_limits<int64_t>::min());
+  const __m512i bits = _mm512_castpd_si512(v);
+  const __mmask8 negative =
+      _mm512_cmplt_epi64_mask(bits, _mm512_setzero_si512());
+  return _mm512_mask_sub_epi64(bits, negative, sign, bits);
+}
+
+__attribute__((target("avx512f"))) bool WithinUlpsAvx512(const double *a,
+                                                         const double *b,
+                                                         std::uint64_t ulps,
+                                                         int n) {
+  const __m512i limit = _mm512_set1_epi64(static_cast<long long>(ulps));
+  int j = 0;
+  for (; j + 8 <= n; j += 8) {
+    const __m512d va = _mm512_loadu_pd(a + j);
+    const __m512d vb = _mm512_loadu_pd(b + j);
+    const __m512i x = OrderedBitsAvx512(va);
+    const __m512i y = OrderedBitsAvx512(vb);
+    const __m512i distance = _mm512_mask_sub_epi64(
+        _mm512_sub_epi64(y, x), _mm512_cmpgt_epi64_mask(x, y), x, y);
+    const __mmask8 bad =
+        _mm512_cmp_epu64_mask(distance, limit, _MM_CMPINT_GT) |
+        _mm512_cmp_pd_mask(va, vb, _CMP_UNORD_Q);
+    if (bad != 0) return false;
+  }
+  return WithinUlpsScalar(a + j, b + j, ulps, n - j);
+}
+
+#endif  // S21_SIMD_X86
+
+const Kernels kScalarKernels = {AddScaledScalar, DotScalar, ScaleScalar,
+                                WithinToleranceScalar, WithinRelativeScalar,
+                                WithinUlpsScalar};
+#ifdef S21_SIMD_X86
+// В SSE2 нет сравнения 64-битных целых, ULP сравниваются скалярно.
+const Kernels kSse2Kernels = {AddScaledSse2, DotSse2, ScaleSse2,
+                              WithinToleranceSse2, WithinRelativeSse2,
+                              WithinUlpsScalar};
+const Kernels kAvx2Kernels = {AddScaledAvx2, DotAvx2, ScaleAvx2,
+                              WithinToleranceAvx2, WithinRelativeAvx2,
+                              WithinUlpsAvx2};
+const Kernels kAvx512Kernels = {AddScaledAvx512, DotAvx512, ScaleAvx512,
+                                WithinToleranceAvx512, WithinRelativeAvx512,
+                                WithinUlpsAvx512};
+#endif
+
+bool Supported(Isa isa) {
+  bool result = isa == Isa::kScalar;
+#ifdef S21_SIMD_X86
+  __builtin_cpu_init();
+  if (isa == Isa::kSse2) result = __builtin_cpu_supports("sse2");
+  if (isa == Isa::kAvx2) result = __builtin_cpu_supports("avx2");
+  if (isa == Isa::kAvx512) result = __builtin_cpu_supports("avx512f");
+#endif
+  return result;
+}
+
+const Kernels *TableFor(Isa isa) {
+  const Kernels *result = &kScalarKernels;
+#ifdef S21_SIMD_X86
+  if (isa == Isa::kSse2) result = &kSse2Kernels;
+  if (isa == Isa::kAvx2) result = &kAvx2Kernels;
+  if (isa == Isa::kAvx512) result = &kAvx512Kernels;
+#endif
+  return result;
+}
+
+Isa InitialIsa() {
+  Isa result = DetectIsa();
+  const char *env = std::getenv("S21_SIMD");
+  if (env != nullptr) {
+    for (Isa isa : {Isa::kScalar, Isa::kSse2, Isa::kAvx2, Isa::kAvx512}) {
+      if (std::strcmp(env, IsaName(isa)) == 0 && Supported(isa)) {
+        result = isa;
+      }
+    }
+  }
+  return result;
+}
+
+struct Dispatch {
+  Dispatch() : isa(InitialIsa()), table(TableFor(isa.load())) {}
+  std::atomic<Isa> isa;
+  std::atomic<const Kernels *> table;
+};
+
+// Ядра выбираются при первом вызове, а не при загрузке библиотеки: так
+// их можно вызывать и из статических инициализаторов других единиц
+// трансляции. Дальше каждый вызов — проверка флага и загрузка указателя.
+Dispatch &Current() {
+  static Dispatch dispatch;
+  return dispatch;
+}
+
+const Kernels &Active() {
+  return *Current().table.load(std::memory_order_relaxed);
+}
+
+}  // namespace
+
+Isa DetectIsa() {
+  Isa result = Isa::kScalar;
+  for (Isa isa : {Isa::kSse2, Isa::kAvx2, Isa::kAvx512}) {
+    if (Supported(isa)) result = isa;
+  }
+  return result;
+}
+
+Isa ActiveIsa() { return Current().isa.load(); }
+
+bool SetActiveIsa(Isa isa) {
+  const bool supported = Supported(isa);
+  if (supported) {
+    Current().isa.store(isa);
+    Current().table.store(TableFor(isa));
+  }
+  return supported;
+}
+
+const char *IsaName(Isa isa) {
+  const char *result = "scalar";
+  if (isa == Isa::kSse2) result = "sse2";
+  if (isa == Isa::kAvx2) result = "avx2";
+  if (isa == Isa::kAvx512) result = "avx512";
+  return result;
+}
+
+bool AddScaled(double *a, const double *b, double sign, int n) {
+  return Active().add_scaled(a, b, sign, n);
+}
+
+double Dot(const double *a, const double *b, int n) {
+  return Active().dot(a, b, n);
+}
+
+void Scale(double *a, double num, int n) { Active().scale(a, num, n); }
+
+bool WithinTolerance(const double *a, const double *b, double tolerance,
+                     int n) {
+  return Active().within_tolerance(a, b, tolerance, n);
+}
+
+bool WithinRelative(const double *a, const double *b, double tolerance,
+                    int n) {
+  return Active().within_relative(a, b, tolerance, n);
+}
+
+bool WithinUlps(const double *a, const double *b, std::uint64_t ulps, int n) {
+  return Active().within_ulps(a, b, ulps, n);
+}
+
+}  // namespace s21::simd
@@ -0,0 +1,52 @@
+#ifndef S21_SIMD_H
+#define S21_SIMD_H
+
+#include <cstdint>
+
+namespace s21::simd {
+
+// Набор векторных инструкций, которым выполняются поэлементные ядра.
+// Выбирается при первом вызове по CPUID (лучший доступный) или переменной
+// окружения S21_SIMD=scalar|sse2|avx2|avx512.
+enum class Isa { kScalar, kSse2, kAvx2, kAvx512 };
+
+Isa DetectIsa();
+Isa ActiveIsa();
+// Переключает ядра на isa; false, если процессор её не поддерживает.
+bool SetActiveIsa(Isa isa);
+const char *IsaName(Isa isa);
+
+// a[j] += sign * b[j] для j < n. Возвращает false, если среди входных
+// значений есть NaN или бесконечность (строка a при этом всё равно
+// обновляется целиком).
+bool AddScaled(double *a, const double *b, double sign, int n);
+
+// Сумма a[j] * b[j] для j < n в нескольких независимых частичных суммах,
+// поэтому результат может отличаться от последовательного в младших битах
+// и зависит от набора инструкций.
+double Dot(const double *a, const double *b, int n);
+
+// a[j] *= num для j < n.
+void Scale(double *a, double num, int n);
+
+// true, если |a[j] - b[j]| <= tolerance для всех j < n (сравнение с NaN
+// не считается расхождением, как и в скалярной версии EqMatrix).
+bool WithinTolerance(const double *a, const double *b, double tolerance,
+                     int n);
+
+// true, если a[j] == b[j] или |a[j] - b[j]| <= tolerance * max(|a[j]|,
+// |b[j]|) для всех j < n. NaN не равен ничему.
+bool WithinRelative(const double *a, const double *b, double tolerance,
+                    int n);
+
+// true, если между a[j] и b[j] не больше ulps представимых double
+// (+0 и -0 совпадают) для всех j < n. NaN не равен ничему. Расстояние
+// между конечными числами разного знака доходит почти до 2^64, поэтому
+// порог беззнаковый: UINT64_MAX принимает любые две не-NaN величины.
+bool WithinUlps(const double *a, const double *b, std::uint64_t ulps, int n);
+
+// Все три проверки останавливаются на первом несовпавшем векторе.
+
+}  // namespace s21::simd
+
+#endif
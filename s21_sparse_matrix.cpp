@@ -0,0 +1,230 @@
+#include "s21_sparse_matrix.h"
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+#include "s21_simd.h"
+#include "s21_thread_pool.h"
+
+namespace {
+
+// Меньше этого числа умножений строки считаются в вызывающем потоке.
+constexpr std::size_t kParallelWork = std::size_t{1} << 20;
+
+// Делит строки на куски с примерно равным числом ненулевых элементов и
+// вызывает body(first, last) для каждого куска, при достаточной работе —
+// в пуле потоков. Куски не пересекаются, поэтому строки результата
+// пишутся без синхронизации.
+void ForRowRanges(const std::vector<std::size_t> &row_begin,
+                  std::size_t work,
+                  const std::function<void(int, int)> &body) {
+  const int rows = static_cast<int>(row_begin.size()) - 1;
+  s21::ThreadPool &pool = s21::ThreadPool::Instance();
+  if (work < kParallelWork || pool.GetThreadCount() == 1) {
+    body(0, rows);
+  } else {
+    const int tasks = pool.GetThreadCount() * 4;
+    const std::size_t nnz = row_begin.back();
+    const auto boundary = [&](int task) {
+      int row = rows;
+      if (task < tasks) {
+        const std::size_t target = nnz * task / tasks;
+        row = static_cast<int>(
+            std::lower_bound(row_begin.begin(), row_begin.end() - 1, target) -
+            row_begin.begin());
+      }
+      return row;
+    };
+    pool.ParallelFor(tasks, [&](int task) {
+      const int first = boundary(task);
+      const int last = boundary(task + 1);
+      if (first < last) body(first, last);
+    });
+  }
+}
+
+}  // namespace
+
+S21SparseMatrix::S21SparseMatrix(int rows, int cols)
+    : rows_(rows), cols_(cols) {
+  if (rows <= 0 || cols <= 0) {
+    throw std::invalid_argument("Rows and columns must be >0");
+  }
+  row_begin_.assign(static_cast<std::size_t>(rows) + 1, 0);
+}
+
+S21SparseMatrix::S21SparseMatrix(const S21MatrixView &dense)
+    : S21SparseMatrix(dense.GetRows(), dense.GetCols()) {
+  for (int i = 0; i < rows_; i++) {
+    for (int j = 0; j < cols_; j++) {
+      const double value = dense.At(i, j);
+      if (value != 0.0) {
+        col_index_.push_back(j);
+        values_.push_back(value);
+      }
+    }
+    row_begin_[i + 1] = values_.size();
+  }
+}
+
+// Подсчёт по строкам и раскладка за O(nnz), затем сортировка каждой
+// строки по столбцам и слияние повторов.
+S21SparseMatrix S21SparseMatrix::FromTriplets(
+    int rows, int cols, std::span<const Triplet> triplets) {
+  S21SparseMatrix result(rows, cols);
+  for (const Triplet &t : triplets) {
+    if (t.row < 0 || t.row >= rows || t.col < 0 || t.col >= cols) {
+      throw std::out_of_range("Index out of bounds");
+    }
+    result.row_begin_[t.row + 1]++;
+  }
+  for (int i = 0; i < rows; i++) {
+    result.row_begin_[i + 1] += result.row_begin_[i];
+  }
+  std::vector<std::pair<int, double>> entries(triplets.size());
+  std::vector<std::size_t> cursor(result.row_begin_.begin(),
+                                  result.row_begin_.end() - 1);
+  for (const Triplet &t : triplets) {
+    entries[cursor[t.row]++] = {t.col, t.value};
+  }
+  result.col_index_.reserve(entries.size());
+  result.values_.reserve(entries.size());
+  const auto by_col = [](const auto &a, const auto &b) {
+    return a.first < b.first;
+  };
+  std::size_t begin = 0;
+  for (int i = 0; i < rows; i++) {
+    const std::size_t end = result.row_begin_[i + 1];
+    std::sort(entries.begin() + begin, entries.begin() + end, by_col);
+    for (std::size_t k = begin; k < end;) {
+      double sum = 0.0;
+      const int col = entries[k].first;
+      for (; k < end && entries[k].first == col; k++) sum += entries[k].second;
+      if (sum != 0.0) {
+        result.col_index_.push_back(col);
+        result.values_.push_back(sum);
+      }
+    }
+    begin = end;
+    result.row_begin_[i + 1] = result.values_.size();
+  }
+  return result;
+}
+
+double S21SparseMatrix::operator()(int i, int j) const {
+  if (i < 0 || i >= rows_ || j < 0 || j >= cols_) {
+    throw std::out_of_range("Index out of bounds");
+  }
+  const auto first = col_index_.begin() + row_begin_[i];
+  const auto last = col_index_.begin() + row_begin_[i + 1];
+  const auto it = std::lower_bound(first, last, j);
+  return it != last && *it == j ? values_[it - col_index_.begin()] : 0.0;
+}
+
+S21Matrix S21SparseMatrix::ToMatrix() const {
+  S21Matrix result(rows_, cols_);
+  for (int i = 0; i < rows_; i++) {
+    for (std::size_t k = row_begin_[i]; k < row_begin_[i + 1]; k++) {
+      result.At(i, col_index_[k]) = values_[k];
+    }
+  }
+  return result;
+}
+
+void S21SparseMatrix::SumMatrix(const S21SparseMatrix &other) {
+  *this = Combine(other, 1.0);
+}
+
+void S21SparseMatrix::SubMatrix(const S21SparseMatrix &other) {
+  *this = Combine(other, -1.0);
+}
+
+S21SparseMatrix S21SparseMatrix::operator+(
+    const S21SparseMatrix &other) const {
+  return Combine(other, 1.0);
+}
+
+S21SparseMatrix S21SparseMatrix::operator-(
+    const S21SparseMatrix &other) const {
+  return Combine(other, -1.0);
+}
+
+// Слияние упорядоченных строк за O(nnz(A) + nnz(B)); взаимно
+// уничтожившиеся элементы не сохраняются.
+S21SparseMatrix S21SparseMatrix::Combine(const S21SparseMatrix &other,
+                                         double sign) const {
+  if (rows_ != other.rows_ || cols_ != other.cols_) {
+    throw std::invalid_argument("Matrices must have the same dimensions");
+  }
+  S21SparseMatrix result(rows_, cols_);
+  result.col_index_.reserve(GetNonZeros() + other.GetNonZeros());
+  result.values_.reserve(GetNonZeros() + other.GetNonZeros());
+  const auto emit = [&result](int col, double value) {
+    if (value != 0.0) {
+      result.col_index_.push_back(col);
+      result.values_.push_back(value);
+    }
+  };
+  for (int i = 0; i < rows_; i++) {
+    std::size_t a = row_begin_[i];
+    std::size_t b = other.row_begin_[i];
+    const std::size_t a_end = row_begin_[i + 1];
+    const std::size_t b_end = other.row_begin_[i + 1];
+    while (a < a_end || b < b_end) {
+      if (b == b_end || (a < a_end && col_index_[a] < other.col_index_[b])) {
+        emit(col_index_[a], values_[a]);
+        a++;
+      } else if (a == a_end || other.col_index_[b] < col_index_[a]) {
+        emit(other.col_index_[b], sign * other.values_[b]);
+        b++;
+      } else {
+        emit(col_index_[a], values_[a] + sign * other.values_[b]);
+        a++;
+        b++;
+      }
+    }
+    result.row_begin_[i + 1] = result.values_.size();
+  }
+  return result;
+}
+
+// Вид с исключениями сначала собирается в плотную копию, чтобы строки
+// правого операнда были непрерывными.
+S21Matrix S21SparseMatrix::operator*(const S21MatrixView &dense) const {
+  if (cols_ != dense.GetRows()) {
+    throw std::invalid_argument("Invalid dimensions for multiplication");
+  }
+  S21Matrix packed;
+  if (dense.HasExclusions()) packed = dense.ToMatrix();
+  const S21MatrixView b = dense.HasExclusions() ? packed : dense;
+  const int n = b.GetCols();
+  S21Matrix result(rows_, n, b.GetLayout());
+  ForRowRanges(row_begin_, GetNonZeros() * n, [&](int first, int last) {
+    for (int i = first; i < last; i++) {
+      double *out = result.Row(i).data();
+      for (std::size_t k = row_begin_[i]; k < row_begin_[i + 1]; k++) {
+        s21::simd::AddScaled(out, b.RowData(col_index_[k]), values_[k], n);
+      }
+    }
+  });
+  return result;
+}
+
+std::vector<double> S21SparseMatrix::operator*(
+    std::span<const double> vector) const {
+  if (vector.size() != static_cast<std::size_t>(cols_)) {
+    throw std::invalid_argument("Invalid dimensions for multiplication");
+  }
+  std::vector<double> result(rows_);
+  ForRowRanges(row_begin_, GetNonZeros(), [&](int first, int last) {
+    for (int i = first; i < last; i++) {
+      double sum = 0.0;
+      for (std::size_t k = row_begin_[i]; k < row_begin_[i + 1]; k++) {
+        sum += values_[k] * vector[col_index_[k]];
+      }
+      result[i] = sum;
+    }
+  });
+  return result;
+}
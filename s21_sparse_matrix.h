@@ -0,0 +1,62 @@
+#ifndef S21_SPARSE_MATRIX_H
+#define S21_SPARSE_MATRIX_H
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+// Разреженная матрица в формате CSR (compressed sparse row): ненулевые
+// элементы строки i — Values()[k] в столбцах ColIndex()[k] для k из
+// [RowBegin()[i], RowBegin()[i + 1]), столбцы внутри строки возрастают.
+// Память и время операций пропорциональны числу ненулевых элементов,
+// поэтому размеры вроде 1 000 000 x 1 000 000 допустимы. Явные нули не
+// хранятся.
+class S21SparseMatrix {
+ public:
+  struct Triplet {
+    int row;
+    int col;
+    double value;
+  };
+
+  // Нулевая матрица rows x cols.
+  S21SparseMatrix(int rows, int cols);
+  // Ненулевые элементы плотной матрицы или вида.
+  explicit S21SparseMatrix(const S21MatrixView &dense);
+  // Элементы в любом порядке; повторы одной позиции складываются.
+  static S21SparseMatrix FromTriplets(int rows, int cols,
+                                      std::span<const Triplet> triplets);
+
+  int GetRows() const noexcept { return rows_; }
+  int GetCols() const noexcept { return cols_; }
+  std::size_t GetNonZeros() const noexcept { return values_.size(); }
+  std::span<const std::size_t> RowBegin() const noexcept { return row_begin_; }
+  std::span<const int> ColIndex() const noexcept { return col_index_; }
+  std::span<const double> Values() const noexcept { return values_; }
+
+  // Элемент (i, j) двоичным поиском по строке i.
+  double operator()(int i, int j) const;
+  S21Matrix ToMatrix() const;
+
+  void SumMatrix(const S21SparseMatrix &other);
+  void SubMatrix(const S21SparseMatrix &other);
+  S21SparseMatrix operator+(const S21SparseMatrix &other) const;
+  S21SparseMatrix operator-(const S21SparseMatrix &other) const;
+  // Разреженная на плотную: каждая ненулевая a(i, k) добавляет
+  // a(i, k) * dense.Row(k) к строке i результата.
+  S21Matrix operator*(const S21MatrixView &dense) const;
+  std::vector<double> operator*(std::span<const double> vector) const;
+
+ private:
+  S21SparseMatrix Combine(const S21SparseMatrix &other, double sign) const;
+
+  int rows_, cols_;
+  // rows_ + 1 смещений; row_begin_[rows_] == GetNonZeros().
+  std::vector<std::size_t> row_begin_;
+  std::vector<int> col_index_;
+  std::vector<double> values_;
+};
+
+#endif
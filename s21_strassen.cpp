@@ -0,0 +1,143 @@
+#include "s21_strassen.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "s21_gemm.h"
+#include "s21_thread_pool.h"
+
+namespace s21 {
+
+namespace {
+
+// Меньше этого числа элементов сложение блоков идёт в вызывающем потоке.
+constexpr long long kParallelWork = 1LL << 18;
+
+double *Row(double *a, int lda, int i) {
+  return a + static_cast<std::size_t>(i) * lda;
+}
+
+const double *Row(const double *a, int lda, int i) {
+  return a + static_cast<std::size_t>(i) * lda;
+}
+
+// out = p + sign * q поэлементно; out может совпадать с p или q.
+void Combine(int rows, int cols, const double *p, int ldp, const double *q,
+             int ldq, double sign, double *out, int ldo) {
+  const auto body = [&](int first, int last) {
+    for (int i = first; i < last; i++) {
+      const double *pi = Row(p, ldp, i);
+      const double *qi = Row(q, ldq, i);
+      double *oi = Row(out, ldo, i);
+      for (int j = 0; j < cols; j++) oi[j] = pi[j] + sign * qi[j];
+    }
+  };
+  ThreadPool &pool = ThreadPool::Instance();
+  if (static_cast<long long>(rows) * cols < kParallelWork ||
+      pool.GetThreadCount() == 1) {
+    body(0, rows);
+  } else {
+    const int tasks = std::min(rows, pool.GetThreadCount() * 4);
+    pool.ParallelFor(tasks, [&](int task) {
+      body(static_cast<int>(static_cast<long long>(rows) * task / tasks),
+           static_cast<int>(static_cast<long long>(rows) * (task + 1) / tasks));
+    });
+  }
+}
+
+// Один уровень Штрассена–Винограда на чётных размерах. Порядок вычислений
+// как в DGEFMM (Douglas et al., 1994): промежуточные произведения
+// хранятся в четвертях C, поэтому на уровень нужны только три временных
+// блока X (m/2 x k/2), Y (k/2 x n/2) и Z (m/2 x n/2).
+void Multiply(int depth, int m, int n, int k, const double *a, int lda,
+              const double *b, int ldb, double *c, int ldc) {
+  if (depth == 0) {
+    Gemm(m, n, k, 1.0, a, lda, b, ldb, 0.0, c, ldc);
+    return;
+  }
+  const int m2 = m / 2, n2 = n / 2, k2 = k / 2;
+  const double *a11 = a, *a12 = a + k2;
+  const double *a21 = Row(a, lda, m2), *a22 = Row(a, lda, m2) + k2;
+  const double *b11 = b, *b12 = b + n2;
+  const double *b21 = Row(b, ldb, k2), *b22 = Row(b, ldb, k2) + n2;
+  double *c11 = c, *c12 = c + n2;
+  double *c21 = Row(c, ldc, m2), *c22 = Row(c, ldc, m2) + n2;
+  std::vector<double> xs(static_cast<std::size_t>(m2) * k2);
+  std::vector<double> ys(static_cast<std::size_t>(k2) * n2);
+  std::vector<double> zs(static_cast<std::size_t>(m2) * n2);
+  double *x = xs.data(), *y = ys.data(), *z = zs.data();
+  const auto mul = [depth](int mm, int nn, int kk, const double *p, int ldp,
+                           const double *q, int ldq, double *r, int ldr) {
+    Multiply(depth - 1, mm, nn, kk, p, ldp, q, ldq, r, ldr);
+  };
+
+  Combine(m2, k2, a11, lda, a21, lda, -1.0, x, k2);  // S3
+  Combine(k2, n2, b22, ldb, b12, ldb, -1.0, y, n2);  // T3
+  mul(m2, n2, k2, x, k2, y, n2, c21, ldc);           // P7
+  Combine(m2, k2, a21, lda, a22, lda, 1.0, x, k2);   // S1
+  Combine(k2, n2, b12, ldb, b11, ldb, -1.0, y, n2);  // T1
+  mul(m2, n2, k2, x, k2, y, n2, c22, ldc);           // P5
+  Combine(m2, k2, x, k2, a11, lda, -1.0, x, k2);     // S2 = S1 - A11
+  Combine(k2, n2, b22, ldb, y, n2, -1.0, y, n2);     // T2 = B22 - T1
+  mul(m2, n2, k2, x, k2, y, n2, c12, ldc);           // P6
+  Combine(m2, k2, a12, lda, x, k2, -1.0, x, k2);     // S4 = A12 - S2
+  mul(m2, n2, k2, x, k2, b22, ldb, c11, ldc);        // P3
+  mul(m2, n2, k2, a11, lda, b11, ldb, z, n2);        // P1
+  Combine(m2, n2, z, n2, c12, ldc, 1.0, c12, ldc);   // U2 = P1 + P6
+  Combine(m2, n2, c12, ldc, c21, ldc, 1.0, c21, ldc);  // U3 = U2 + P7
+  Combine(m2, n2, c12, ldc, c22, ldc, 1.0, c12, ldc);  // U4 = U2 + P5
+  Combine(m2, n2, c21, ldc, c22, ldc, 1.0, c22, ldc);  // C22 = U3 + P5
+  Combine(m2, n2, c12, ldc, c11, ldc, 1.0, c12, ldc);  // C12 = U4 + P3
+  Combine(k2, n2, y, n2, b21, ldb, -1.0, y, n2);       // T4 = T2 - B21
+  mul(m2, n2, k2, a22, lda, y, n2, c11, ldc);          // P4
+  Combine(m2, n2, c21, ldc, c11, ldc, -1.0, c21, ldc);  // C21 = U3 - P4
+  mul(m2, n2, k2, a12, lda, b21, ldb, c11, ldc);        // P2
+  Combine(m2, n2, z, n2, c11, ldc, 1.0, c11, ldc);      // C11 = P1 + P2
+}
+
+// Копия rows x cols в буфер padded_rows x padded_cols с нулями справа и
+// снизу.
+std::vector<double> Pad(int rows, int cols, const double *a, int lda,
+                        int padded_rows, int padded_cols) {
+  std::vector<double> result(static_cast<std::size_t>(padded_rows) *
+                             padded_cols);
+  for (int i = 0; i < rows; i++) {
+    std::copy_n(Row(a, lda, i), cols, Row(result.data(), padded_cols, i));
+  }
+  return result;
+}
+
+}  // namespace
+
+// Число уровней выбирается так, чтобы все размеры листьев были не больше
+// crossover; размеры дополняются до кратных 2^depth (меньше чем на 2^depth
+// строк и столбцов), и только тогда операнды копируются.
+void StrassenGemm(int m, int n, int k, const double *a, int lda,
+                  const double *b, int ldb, double *c, int ldc,
+                  int crossover) {
+  int depth = 0;
+  for (int mm = m, nn = n, kk = k; std::min({mm, nn, kk}) > crossover;
+       depth++) {
+    mm = (mm + 1) / 2;
+    nn = (nn + 1) / 2;
+    kk = (kk + 1) / 2;
+  }
+  const int mask = (1 << depth) - 1;
+  const int pm = (m + mask) & ~mask;
+  const int pn = (n + mask) & ~mask;
+  const int pk = (k + mask) & ~mask;
+  if (pm == m && pn == n && pk == k) {
+    Multiply(depth, m, n, k, a, lda, b, ldb, c, ldc);
+  } else {
+    const std::vector<double> pa = Pad(m, k, a, lda, pm, pk);
+    const std::vector<double> pb = Pad(k, n, b, ldb, pk, pn);
+    std::vector<double> pc(static_cast<std::size_t>(pm) * pn);
+    Multiply(depth, pm, pn, pk, pa.data(), pk, pb.data(), pn, pc.data(), pn);
+    for (int i = 0; i < m; i++) {
+      std::copy_n(Row(pc.data(), pn, i), n, Row(c, ldc, i));
+    }
+  }
+}
+
+}  // namespace s21
@@ -0,0 +1,22 @@
+#ifndef S21_STRASSEN_H
+#define S21_STRASSEN_H
+
+namespace s21 {
+
+// Порог по умолчанию: пока все размеры больше него, произведение делится
+// на 7 половинных, меньшие считаются классическим Gemm. Ниже этого
+// размера Gemm быстрее, чем лишние сложения блоков.
+constexpr int kStrassenCrossover = 512;
+
+// C = A * B вариантом Штрассена–Винограда (7 умножений и 15 сложений
+// блоков на уровень) для row-major матриц: A — m x k (lda), B — k x n
+// (ldb), C — m x n (ldc), исходное содержимое C не читается. Размеры
+// дополняются нулями до кратных 2^уровней; при совпадении копий нет.
+// Погрешность выше классической (не поэлементная, а нормовая оценка).
+void StrassenGemm(int m, int n, int k, const double *a, int lda,
+                  const double *b, int ldb, double *c, int ldc,
+                  int crossover = kStrassenCrossover);
+
+}  // namespace s21
+
+#endif
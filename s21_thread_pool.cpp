@@ -0,0 +1,179 @@
+#include "s21_thread_pool.h"
+
+#include <cstdlib>
+#include <stdexcept>
+
+namespace s21 {
+
+namespace {
+
+// Поток уже выполняет задачи пула: вложенный ParallelFor идёт без пула.
+thread_local bool in_pool = false;
+
+// Отмечает поток как выполняющий задачи на время последовательного
+// прохода ParallelFor (в том числе при выходе по исключению).
+class InPoolScope {
+ public:
+  InPoolScope() : saved_(in_pool) { in_pool = true; }
+  ~InPoolScope() { in_pool = saved_; }
+  InPoolScope(const InPoolScope &) = delete;
+  InPoolScope &operator=(const InPoolScope &) = delete;
+
+ private:
+  bool saved_;
+};
+
+int DefaultThreadCount() {
+  int count = static_cast<int>(std::thread::hardware_concurrency());
+  const char *env = std::getenv("S21_NUM_THREADS");
+  if (env != nullptr) {
+    char *end = nullptr;
+    long value = std::strtol(env, &end, 10);
+    if (end != env && *end == '\0' && value > 0 && value <= 4096) {
+      count = static_cast<int>(value);
+    }
+  }
+  return count > 0 ? count : 1;
+}
+
+}  // namespace
+
+ThreadPool &ThreadPool::Instance() {
+  static ThreadPool pool;
+  return pool;
+}
+
+ThreadPool::ThreadPool()
+    : thread_count_(1),
+      body_(nullptr),
+      task_count_(0),
+      next_task_(0),
+      active_(0),
+      generation_(0),
+      stopping_(false) {
+  Start(DefaultThreadCount());
+}
+
+ThreadPool::~ThreadPool() { Stop(); }
+
+void ThreadPool::SetThreadCount(int count) {
+  if (count < 1) {
+    throw std::invalid_argument("Thread count must be >= 1");
+  }
+  // Остановка ждёт все рабочие потоки, включая тот, что выполняет эту
+  // задачу, а вызывающий ParallelFor держит submit_mutex_.
+  if (in_pool) {
+    throw std::logic_error("Thread count cannot be changed from a pool task");
+  }
+  std::lock_guard<std::mutex> submit(submit_mutex_);
+  if (count != thread_count_) {
+    Stop();
+    Start(count);
+  }
+}
+
+int ThreadPool::GetThreadCount() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return thread_count_;
+}
+
+void ThreadPool::ParallelFor(int count,
+                             const std::function<void(int)> &body) {
+  if (count <= 0) return;
+  std::unique_lock<std::mutex> submit(submit_mutex_, std::defer_lock);
+  if (!in_pool && count > 1) submit.lock();
+  if (!submit.owns_lock() || workers_.empty()) {
+    const InPoolScope scope;
+    for (int task = 0; task < count; task++) {
+      body(task);
+    }
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    body_ = &body;
+    task_count_ = count;
+    next_task_ = 0;
+    active_ = static_cast<int>(workers_.size()) + 1;
+    error_ = nullptr;
+    generation_++;
+  }
+  wake_.notify_all();
+  RunTasks();
+
+  std::exception_ptr error;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (--active_ == 0) done_.notify_all();
+    done_.wait(lock, [this] { return active_ == 0; });
+    body_ = nullptr;
+    error = error_;
+    error_ = nullptr;
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+void ThreadPool::Start(int count) {
+  unsigned long generation;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    thread_count_ = count;
+    generation = generation_;
+  }
+  for (int i = 1; i < count; i++) {
+    workers_.emplace_back(&ThreadPool::WorkerLoop, this, generation);
+  }
+}
+
+void ThreadPool::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  wake_.notify_all();
+  for (std::thread &worker : workers_) {
+    worker.join();
+  }
+  workers_.clear();
+  std::lock_guard<std::mutex> lock(mutex_);
+  stopping_ = false;
+  thread_count_ = 1;
+}
+
+// seen — поколение на момент создания потока: задание, опубликованное до
+// того, как поток впервые захватил мьютекс, не будет пропущено.
+void ThreadPool::WorkerLoop(unsigned long seen) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    wake_.wait(lock, [&] { return stopping_ || generation_ != seen; });
+    if (stopping_) break;
+    seen = generation_;
+    lock.unlock();
+    RunTasks();
+    lock.lock();
+    if (--active_ == 0) done_.notify_all();
+  }
+}
+
+void ThreadPool::RunTasks() {
+  in_pool = true;
+  while (true) {
+    int task;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (next_task_ >= task_count_) break;
+      task = next_task_++;
+    }
+    try {
+      (*body_)(task);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!error_) error_ = std::current_exception();
+      next_task_ = task_count_;
+    }
+  }
+  in_pool = false;
+}
+
+}  // namespace s21
@@ -0,0 +1,60 @@
+#ifndef S21_THREAD_POOL_H
+#define S21_THREAD_POOL_H
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace s21 {
+
+// Пул потоков библиотеки. Размер берётся из переменной окружения
+// S21_NUM_THREADS, иначе равен числу аппаратных потоков, и может быть
+// изменён во время работы через SetThreadCount.
+class ThreadPool {
+ public:
+  static ThreadPool &Instance();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+  ~ThreadPool();
+
+  // Общее число потоков, включая вызывающий. Должно быть >= 1. Из задачи
+  // ParallelFor вызывать нельзя (std::logic_error).
+  void SetThreadCount(int count);
+  int GetThreadCount() const;
+
+  // Вызывает body(task) для task из [0, count) и ждёт завершения всех
+  // задач. Вызывающий поток тоже выполняет задачи; вложенные вызовы из
+  // задач выполняются последовательно. Первое исключение из body
+  // пробрасывается вызывающему.
+  void ParallelFor(int count, const std::function<void(int)> &body);
+
+ private:
+  ThreadPool();
+  void Start(int count);
+  void Stop();
+  void WorkerLoop(unsigned long seen);
+  void RunTasks();
+
+  std::vector<std::thread> workers_;
+  int thread_count_;
+  // Сериализует ParallelFor и SetThreadCount между внешними потоками.
+  std::mutex submit_mutex_;
+  mutable std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable done_;
+  const std::function<void(int)> *body_;
+  int task_count_;
+  int next_task_;
+  int active_;
+  unsigned long generation_;
+  bool stopping_;
+  std::exception_ptr error_;
+};
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,93 @@
+#include "s21_transpose.h"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+namespace {
+
+// Плитка 32 x 32 источника и приёмника (по 8 КиБ) помещается в L1.
+constexpr int kLeaf = 32;
+
+std::size_t Offset(int i, int ld) { return static_cast<std::size_t>(i) * ld; }
+
+// Меняет местами блок A (m x n) и транспонированный блок B (n x m) с
+// общим шагом строк ld: a[i][j] <-> b[j][i].
+void SwapTransposed(int m, int n, double *a, double *b, int ld) {
+  if (m <= kLeaf && n <= kLeaf) {
+    for (int i = 0; i < m; i++) {
+      for (int j = 0; j < n; j++) {
+        std::swap(a[Offset(i, ld) + j], b[Offset(j, ld) + i]);
+      }
+    }
+  } else if (m >= n) {
+    const int h = m / 2;
+    SwapTransposed(h, n, a, b, ld);
+    SwapTransposed(m - h, n, a + Offset(h, ld), b + h, ld);
+  } else {
+    const int h = n / 2;
+    SwapTransposed(m, h, a, b, ld);
+    SwapTransposed(m, n - h, a + h, b + Offset(h, ld), ld);
+  }
+}
+
+}  // namespace
+
+void Transpose(int m, int n, const double *a, int lda, double *b, int ldb) {
+  if (m <= kLeaf && n <= kLeaf) {
+    for (int i = 0; i < m; i++) {
+      const double *row = a + Offset(i, lda);
+      for (int j = 0; j < n; j++) {
+        b[Offset(j, ldb) + i] = row[j];
+      }
+    }
+  } else if (m >= n) {
+    const int h = m / 2;
+    Transpose(h, n, a, lda, b, ldb);
+    Transpose(m - h, n, a + Offset(h, lda), lda, b + h, ldb);
+  } else {
+    const int h = n / 2;
+    Transpose(m, h, a, lda, b, ldb);
+    Transpose(m, n - h, a + h, lda, b + Offset(h, ldb), ldb);
+  }
+}
+
+void TransposeSquare(int n, double *a, int lda) {
+  if (n <= kLeaf) {
+    for (int i = 0; i < n; i++) {
+      for (int j = i + 1; j < n; j++) {
+        std::swap(a[Offset(i, lda) + j], a[Offset(j, lda) + i]);
+      }
+    }
+  } else {
+    const int h = n / 2;
+    TransposeSquare(h, a, lda);
+    TransposeSquare(n - h, a + Offset(h, lda) + h, lda);
+    SwapTransposed(h, n - h, a + h, a + Offset(h, lda), lda);
+  }
+}
+
+void TransposePacked(int m, int n, double *a) {
+  // Вектор-строка и вектор-столбец в плотной раскладке совпадают.
+  if (m > 1 && n > 1) {
+    const std::size_t last = static_cast<std::size_t>(m) * n - 1;
+    std::vector<bool> moved(last);
+    for (std::size_t start = 1; start < last; start++) {
+      if (!moved[start]) {
+        // Элемент (i, j) с индексом k = i * n + j переходит в j * m + i,
+        // что равно k * m mod (m * n - 1).
+        double value = a[start];
+        std::size_t k = start;
+        do {
+          k = k * m % last;
+          std::swap(value, a[k]);
+          moved[k] = true;
+        } while (k != start);
+      }
+    }
+  }
+}
+
+}  // namespace s21
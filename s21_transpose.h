@@ -0,0 +1,23 @@
+#ifndef S21_TRANSPOSE_H
+#define S21_TRANSPOSE_H
+
+namespace s21 {
+
+// B = A^T для row-major матриц с произвольным шагом строк: A — m x n (lda),
+// B — n x m (ldb). Рекурсивное деление пополам по большей стороне
+// (cache-oblivious) до плиток, которые помещаются в L1.
+void Transpose(int m, int n, const double *a, int lda, double *b, int ldb);
+
+// A = A^T на месте для квадратной матрицы n x n с шагом строк lda:
+// диагональные блоки транспонируются рекурсивно, внедиагональные
+// меняются местами с транспонированием.
+void TransposeSquare(int n, double *a, int lda);
+
+// A = A^T на месте для плотной (шаг строки = n) матрицы m x n: элементы
+// переставляются по циклам перестановки k -> k * m mod (m * n - 1).
+// Дополнительная память — один бит на элемент.
+void TransposePacked(int m, int n, double *a);
+
+}  // namespace s21
+
+#endif
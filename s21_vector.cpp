@@ -0,0 +1,73 @@
+#include "s21_vector.h"
+
+#include <cmath>
+#include <stdexcept>
+
+#include "s21_gemm.h"
+
+S21Vector::S21Vector(int size) {
+  if (size <= 0) throw std::invalid_argument("Size must be >0");
+  data_.assign(size, 0.0);
+}
+
+S21Vector::S21Vector(std::initializer_list<double> values) : data_(values) {
+  if (data_.empty()) throw std::invalid_argument("Size must be >0");
+}
+
+S21Vector::S21Vector(std::span<const double> values)
+    : data_(values.begin(), values.end()) {
+  if (data_.empty()) throw std::invalid_argument("Size must be >0");
+}
+
+double &S21Vector::operator()(int i) {
+  if (i < 0 || i >= GetSize()) throw std::out_of_range("Index out of bounds");
+  return data_[i];
+}
+
+double S21Vector::operator()(int i) const {
+  if (i < 0 || i >= GetSize()) throw std::out_of_range("Index out of bounds");
+  return data_[i];
+}
+
+// Вид с исключениями собирается в плотную копию (GEMV нужен постоянный
+// шаг строк), x, совпадающий с *this, копируется до записи результата.
+void S21Vector::Gemv(double alpha, const S21MatrixView &a, const S21Vector &x,
+                     double beta, bool transpose_a) {
+  if (!std::isfinite(alpha) || !std::isfinite(beta)) {
+    throw std::invalid_argument("Number must be finite");
+  }
+  const int m = transpose_a ? a.GetCols() : a.GetRows();
+  const int n = transpose_a ? a.GetRows() : a.GetCols();
+  if (GetSize() != m || x.GetSize() != n) {
+    throw std::invalid_argument("Invalid dimensions for multiplication");
+  }
+  S21Matrix packed;
+  if (a.HasExclusions()) packed = a.ToMatrix();
+  const S21MatrixView op = a.HasExclusions() ? packed : a;
+  S21Vector copy;
+  if (&x == this) copy = x;
+  const S21Vector &input = &x == this ? copy : x;
+  s21::Gemv(transpose_a ? s21::Trans::kYes : s21::Trans::kNo, op.GetRows(),
+            op.GetCols(), alpha, op.RowData(0), op.GetStride(), input.Data(),
+            beta, Data());
+}
+
+S21Vector operator*(const S21MatrixView &a, const S21Vector &x) {
+  S21Vector result(a.GetRows());
+  result.Gemv(1.0, a, x, 0.0);
+  return result;
+}
+
+S21Vector operator*(const S21Matrix &a, const S21Vector &x) {
+  return S21MatrixView(a) * x;
+}
+
+S21Vector operator*(const S21Vector &x, const S21MatrixView &a) {
+  S21Vector result(a.GetCols());
+  result.Gemv(1.0, a, x, 0.0, true);
+  return result;
+}
+
+S21Vector operator*(const S21Vector &x, const S21Matrix &a) {
+  return x * S21MatrixView(a);
+}
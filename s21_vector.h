@@ -0,0 +1,60 @@
+#ifndef S21_VECTOR_H
+#define S21_VECTOR_H
+
+#include <cassert>
+#include <initializer_list>
+#include <span>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+#include "s21_matrix_view.h"
+
+// Плотный вектор-столбец: один непрерывный буфер без таблицы строк.
+// Произведения с матрицами идут через GEMV (s21::Gemv), а не через
+// MulMatrix с матрицей n x 1. Приводится к std::span<const double>, так
+// что подходит и для S21SparseMatrix::operator*.
+class S21Vector {
+ public:
+  S21Vector() = default;
+  // size нулей.
+  explicit S21Vector(int size);
+  // Пустой список или span — std::invalid_argument, как size <= 0.
+  S21Vector(std::initializer_list<double> values);
+  explicit S21Vector(std::span<const double> values);
+
+  int GetSize() const noexcept { return static_cast<int>(data_.size()); }
+  double *Data() noexcept { return data_.data(); }
+  const double *Data() const noexcept { return data_.data(); }
+  operator std::span<const double>() const noexcept { return data_; }
+  operator std::span<double>() noexcept { return data_; }
+
+  // С проверкой индекса (std::out_of_range).
+  double &operator()(int i);
+  double operator()(int i) const;
+  // Без проверок, только assert в отладочной сборке.
+  double &At(int i) noexcept {
+    assert(i >= 0 && i < GetSize());
+    return data_[i];
+  }
+  double At(int i) const noexcept {
+    assert(i >= 0 && i < GetSize());
+    return data_[i];
+  }
+
+  // *this = alpha * op(a) * x + beta * *this, op(a) — a или a^T по флагу.
+  // Результат пишется прямо в вектор; x может быть самим *this.
+  void Gemv(double alpha, const S21MatrixView &a, const S21Vector &x,
+            double beta, bool transpose_a = false);
+
+ private:
+  std::vector<double> data_;
+};
+
+// a * x.
+S21Vector operator*(const S21MatrixView &a, const S21Vector &x);
+S21Vector operator*(const S21Matrix &a, const S21Vector &x);
+// x^T * a как вектор-столбец, т. е. a^T * x, без транспонирования a.
+S21Vector operator*(const S21Vector &x, const S21MatrixView &a);
+S21Vector operator*(const S21Vector &x, const S21Matrix &a);
+
+#endif
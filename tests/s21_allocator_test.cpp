@@ -0,0 +1,117 @@
+#include "../s21_allocator.h"
+
+#include <thread>
+
+#include "../s21_matrix_oop.h"
+
+namespace {
+
+// Подменяет аллокатор матриц на время теста.
+class AllocatorGuard {
+ public:
+  explicit AllocatorGuard(s21::MatrixAllocator &allocator)
+      : previous_(s21::SetMatrixAllocator(allocator)) {}
+  ~AllocatorGuard() { s21::SetMatrixAllocator(previous_); }
+
+ private:
+  s21::MatrixAllocator &previous_;
+};
+
+class CountingAllocator : public s21::MatrixAllocator {
+ public:
+  void *Allocate(std::size_t bytes) override {
+    allocations++;
+    return s21::HeapAllocator::Instance().Allocate(bytes);
+  }
+  void Deallocate(void *block, std::size_t bytes) override {
+    deallocations++;
+    s21::HeapAllocator::Instance().Deallocate(block, bytes);
+  }
+  s21::AllocatorStats GetStats() const override {
+    return {allocations, deallocations, 0, allocations, 0, 0};
+  }
+
+  std::size_t allocations = 0;
+  std::size_t deallocations = 0;
+};
+
+}  // namespace
+
+TEST(Allocator, PoolReusesBlocks) {
+  s21::PoolAllocator &pool = s21::PoolAllocator::Instance();
+  AllocatorGuard guard(pool);
+  pool.Trim();
+  const s21::AllocatorStats before = pool.GetStats();
+  const double *first = nullptr;
+  {
+    S21Matrix a(20, 20);
+    first = a.getMatrix()[0];
+  }
+  EXPECT_GT(pool.GetStats().bytes_cached, before.bytes_cached);
+  S21Matrix b(20, 20);
+  EXPECT_EQ(b.getMatrix()[0], first);
+  EXPECT_DOUBLE_EQ(b(19, 19), 0.0);
+
+  const s21::AllocatorStats after = pool.GetStats();
+  EXPECT_EQ(after.allocations - before.allocations, 2u);
+  EXPECT_EQ(after.reused - before.reused, 1u);
+  EXPECT_EQ(after.heap_allocations - before.heap_allocations, 1u);
+  EXPECT_EQ(after.deallocations - before.deallocations, 1u);
+  EXPECT_GT(after.bytes_in_use, before.bytes_in_use);
+}
+
+TEST(Allocator, TemporariesStayInPool) {
+  s21::PoolAllocator &pool = s21::PoolAllocator::Instance();
+  AllocatorGuard guard(pool);
+  S21Matrix a(6, 6);
+  for (int i = 0; i < 6; i++) a(i, i) = i + 1.0;
+  a.Determinant();
+  const std::size_t heap = pool.GetStats().heap_allocations;
+  for (int k = 0; k < 10; k++) {
+    EXPECT_DOUBLE_EQ(a.Determinant(), 720.0);
+    S21Matrix sum = a + a;
+  }
+  EXPECT_EQ(pool.GetStats().heap_allocations, heap);
+}
+
+TEST(Allocator, MatrixReturnsBlockToItsAllocator) {
+  CountingAllocator counting;
+  S21Matrix *outlived = nullptr;
+  {
+    AllocatorGuard guard(counting);
+    S21Matrix a(3, 3);
+    outlived = new S21Matrix(a);
+    S21Matrix moved = std::move(a);
+    EXPECT_EQ(counting.allocations, 2u);
+  }
+  EXPECT_EQ(counting.deallocations, 1u);
+  delete outlived;
+  EXPECT_EQ(counting.deallocations, 2u);
+}
+
+TEST(Allocator, ThreadCacheReleasedOnExit) {
+  s21::PoolAllocator &pool = s21::PoolAllocator::Instance();
+  AllocatorGuard guard(pool);
+  const std::size_t cached = pool.GetStats().bytes_cached;
+  S21Matrix a(50, 50);
+  std::thread worker([&a] {
+    S21Matrix local = std::move(a);
+    S21Matrix other(50, 50);
+  });
+  worker.join();
+  EXPECT_EQ(a.getMatrix(), nullptr);
+  EXPECT_EQ(pool.GetStats().bytes_cached, cached);
+}
+
+TEST(Allocator, LargeBlocksBypassPool) {
+  s21::PoolAllocator &pool = s21::PoolAllocator::Instance();
+  AllocatorGuard guard(pool);
+  const s21::AllocatorStats before = pool.GetStats();
+  {
+    S21Matrix big(2048, 2049);
+  }
+  const s21::AllocatorStats after = pool.GetStats();
+  EXPECT_EQ(after.heap_allocations - before.heap_allocations, 1u);
+  EXPECT_EQ(after.bytes_cached, before.bytes_cached);
+  EXPECT_EQ(after.bytes_in_use, before.bytes_in_use);
+}
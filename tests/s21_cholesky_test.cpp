@@ -0,0 +1,73 @@
+#include "../s21_cholesky.h"
+
+namespace {
+
+// M M^T + n I: симметричная положительно определённая.
+S21Matrix Spd(int n) {
+  S21Matrix m(n, n);
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) m(i, j) = ((i * 5 + j * 3) % 7) / 7.0 - 0.4;
+  }
+  S21Matrix result(n, n);
+  result.Gemm(1.0, m, m, 0.0, false, true);
+  for (int i = 0; i < n; i++) result(i, i) += n;
+  return result;
+}
+
+}  // namespace
+
+TEST(Cholesky, FactorMatchesMatrix) {
+  for (int n : {1, 3, 64, 150}) {
+    S21Matrix a = Spd(n);
+    S21Cholesky cholesky(a);
+    const S21Matrix &l = cholesky.GetL();
+    for (int i = 0; i < n; i++) {
+      for (int j = i + 1; j < n; j++) EXPECT_EQ(l(i, j), 0.0);
+    }
+    S21Matrix product(n, n);
+    product.Gemm(1.0, l, l, 0.0, false, true);
+    EXPECT_TRUE(product.EqMatrix(a, S21Matrix::Tolerance::Relative(1e-12)));
+    // У n = 150 определитель выходит за пределы double.
+    if (n < 100) {
+      EXPECT_NEAR(cholesky.Determinant() / a.Determinant(), 1.0, 1e-9);
+    }
+  }
+}
+
+TEST(Cholesky, SolveAndInverse) {
+  const int n = 130;
+  S21Matrix a = Spd(n);
+  S21Matrix b(n, 3);
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < 3; j++) b(i, j) = i - j * 10.0;
+  }
+  S21Cholesky cholesky(a);
+  const S21Matrix x = cholesky.Solve(b);
+  EXPECT_TRUE((a * x).EqMatrix(b, S21Matrix::Tolerance::Absolute(1e-9)));
+  EXPECT_TRUE(cholesky.InverseMatrix().EqMatrix(a.InverseMatrix()));
+  EXPECT_THROW(cholesky.Solve(S21Matrix(n + 1, 1)), std::invalid_argument);
+}
+
+TEST(Cholesky, UsesLowerTriangleAndOwnStorage) {
+  S21Matrix a = Spd(5);
+  S21Matrix lower(a);
+  for (int i = 0; i < 5; i++) {
+    for (int j = i + 1; j < 5; j++) lower(i, j) = 1e6;
+  }
+  const double *storage = lower.Data();
+  S21Cholesky cholesky(std::move(lower));
+  EXPECT_EQ(cholesky.GetL().Data(), storage);
+  EXPECT_TRUE(cholesky.GetL().EqMatrix(S21Cholesky(a).GetL()));
+}
+
+TEST(Cholesky, RejectsIndefinite) {
+  S21Matrix a = Spd(70);
+  EXPECT_TRUE(S21Cholesky::IsPositiveDefinite(a));
+  a(66, 66) = -1.0;
+  EXPECT_FALSE(S21Cholesky::IsPositiveDefinite(a));
+  EXPECT_THROW(S21Cholesky{a}, std::runtime_error);
+  EXPECT_THROW(S21Cholesky(S21Matrix(2, 3)), std::invalid_argument);
+  EXPECT_THROW(S21Cholesky::IsPositiveDefinite(S21Matrix(2, 3)),
+               std::invalid_argument);
+  EXPECT_THROW(S21Cholesky{S21Matrix()}, std::runtime_error);
+}
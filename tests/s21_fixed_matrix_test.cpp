@@ -0,0 +1,97 @@
+#include "../s21_fixed_matrix.h"
+
+#include <limits>
+#include <type_traits>
+
+namespace {
+
+constexpr S21FixedMatrix<3, 3> kRotation{0, -1, 0, 1, 0, 0, 0, 0, 1};
+constexpr S21FixedMatrix<3, 3> kGeneral{1, 2, 3, 0, 4, 5, 1, 0, 6};
+
+static_assert(kRotation.Determinant() == 1.0);
+static_assert(kGeneral.Determinant() == 22.0);
+static_assert((kRotation * kRotation.Transpose()).EqMatrix(
+    S21FixedMatrix<3, 3>{1, 0, 0, 0, 1, 0, 0, 0, 1}));
+static_assert((kGeneral * kGeneral.InverseMatrix())
+                  .EqMatrix(S21FixedMatrix<3, 3>{1, 0, 0, 0, 1, 0, 0, 0, 1}));
+static_assert(S21FixedMatrix<2, 3>::GetRows() == 2);
+static_assert(sizeof(S21FixedMatrix<4, 4>) == 16 * sizeof(double));
+
+constexpr double kNan = std::numeric_limits<double>::quiet_NaN();
+
+// NaN в разности не противоречит равенству, как в S21Matrix::EqMatrix.
+static_assert(S21FixedMatrix<1, 2>{kNan, 2}.EqMatrix({1, 2}));
+static_assert(!S21FixedMatrix<1, 2>{kNan, 2}.EqMatrix({1, 3}));
+
+// Вычисление f() — константное выражение (не выбрасывает исключений).
+template <auto f>
+constexpr bool IsConstant() {
+  return requires { typename std::bool_constant<(f(), true)>; };
+}
+
+static_assert(!IsConstant<[] {
+  return S21FixedMatrix<1, 1>{5}.CalcComplements();
+}>());
+static_assert(IsConstant<[] {
+  return S21FixedMatrix<2, 2>{1, 2, 3, 4}.CalcComplements();
+}>());
+static_assert(S21FixedMatrix<1, 1>{4}.InverseMatrix()(0, 0) == 0.25);
+
+}  // namespace
+
+TEST(FixedMatrix, MatchesDynamicMatrix) {
+  S21FixedMatrix<4, 4> a{2, 1, 0, 3, 1, 5, 2, 0, 0, 2, 7, 1, 3, 0, 1, 9};
+  S21Matrix dynamic = a.ToS21Matrix();
+  EXPECT_NEAR(a.Determinant(), dynamic.Determinant(), 1e-9);
+  using Fixed4 = S21FixedMatrix<4, 4>;
+  EXPECT_TRUE(Fixed4(dynamic.InverseMatrix()) == a.InverseMatrix());
+  EXPECT_TRUE(Fixed4(dynamic.CalcComplements()) == a.CalcComplements());
+  EXPECT_TRUE(Fixed4(dynamic * dynamic) == a * a);
+}
+
+TEST(FixedMatrix, OneByOneMatchesDynamicMatrix) {
+  S21FixedMatrix<1, 1> a{5};
+  S21Matrix dynamic = a.ToS21Matrix();
+  EXPECT_THROW(dynamic.CalcComplements(), std::invalid_argument);
+  EXPECT_THROW(a.CalcComplements(), std::invalid_argument);
+  using Fixed1 = S21FixedMatrix<1, 1>;
+  EXPECT_TRUE(Fixed1(dynamic.InverseMatrix()) == a.InverseMatrix());
+}
+
+TEST(FixedMatrix, RectangularProductAndTranspose) {
+  S21FixedMatrix<2, 3> a{1, 2, 3, 4, 5, 6};
+  S21FixedMatrix<3, 2> b = a.Transpose();
+  S21FixedMatrix<2, 2> c = a * b;
+  EXPECT_DOUBLE_EQ(c(0, 0), 14.0);
+  EXPECT_DOUBLE_EQ(c(0, 1), 32.0);
+  EXPECT_DOUBLE_EQ(c(1, 1), 77.0);
+  a *= S21FixedMatrix<3, 3>{1, 0, 0, 0, 1, 0, 0, 0, 1};
+  EXPECT_DOUBLE_EQ(a(1, 2), 6.0);
+}
+
+TEST(FixedMatrix, ArithmeticOperators) {
+  S21FixedMatrix<2, 2> a{1, 2, 3, 4};
+  S21FixedMatrix<2, 2> b{4, 3, 2, 1};
+  S21FixedMatrix<2, 2> c = (a + b) * 2.0 - a;
+  EXPECT_TRUE(c == (S21FixedMatrix<2, 2>{9, 8, 7, 6}));
+  c -= b;
+  c += a;
+  EXPECT_TRUE(c == (S21FixedMatrix<2, 2>{6, 7, 8, 9}));
+  EXPECT_TRUE(0.5 * c == c * 0.5);
+}
+
+TEST(FixedMatrix, Errors) {
+  S21FixedMatrix<2, 2> singular{1, 2, 2, 4};
+  EXPECT_THROW(singular.InverseMatrix(), std::runtime_error);
+  S21FixedMatrix<5, 5> big;
+  EXPECT_THROW(big.InverseMatrix(), std::runtime_error);
+  EXPECT_DOUBLE_EQ(big.Determinant(), 0.0);
+  EXPECT_THROW(singular(2, 0), std::out_of_range);
+  EXPECT_THROW(singular *= std::numeric_limits<double>::infinity(),
+               std::invalid_argument);
+  EXPECT_THROW((S21FixedMatrix<2, 2>{1, 2, 3}), std::invalid_argument);
+  using Fixed2 = S21FixedMatrix<2, 2>;
+  EXPECT_THROW(Fixed2(S21Matrix(2, 3)), std::invalid_argument);
+  S21Matrix empty;
+  EXPECT_THROW(Fixed2{empty}, std::runtime_error);
+}
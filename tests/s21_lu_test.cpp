@@ -0,0 +1,92 @@
+#include "../s21_lu.h"
+
+#include "../s21_matrix_view.h"
+
+namespace {
+
+// Диагонально преобладающая несимметричная матрица n x n.
+S21Matrix Regular(int n) {
+  S21Matrix m(n, n);
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) m(i, j) = ((i * 7 + j * 3) % 11) / 11.0 - 0.5;
+    m(i, i) += n;
+  }
+  return m;
+}
+
+}  // namespace
+
+TEST(Lu, SolveMultipleRightHandSides) {
+  for (int n : {1, 4, 70, 150}) {
+    const S21Matrix a = Regular(n);
+    S21Matrix b(n, 5);
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < 5; j++) b(i, j) = i * 0.5 - j;
+    }
+    S21Lu lu(a);
+    EXPECT_FALSE(lu.IsSingular());
+    const S21Matrix x = lu.Solve(b);
+    EXPECT_TRUE((a * x).EqMatrix(b, S21Matrix::Tolerance::Absolute(1e-9)));
+    if (n < 100) {
+      EXPECT_NEAR(lu.Determinant() / S21Matrix(a).Determinant(), 1.0, 1e-9);
+    }
+  }
+}
+
+TEST(Lu, ReusedFactorizationMatchesInverse) {
+  const int n = 90;
+  S21Matrix a = Regular(n);
+  // Нулевой ведущий элемент требует перестановки строк.
+  a(0, 0) = 0.0;
+  S21Lu lu(a);
+  EXPECT_TRUE(lu.InverseMatrix().EqMatrix(a.InverseMatrix()));
+  for (int k = 0; k < 3; k++) {
+    S21Matrix b(n, 1);
+    for (int i = 0; i < n; i++) b(i, 0) = (i + k) % 4;
+    S21Matrix x = b;
+    const double *storage = x.Data();
+    lu.SolveInPlace(x);
+    EXPECT_EQ(x.Data(), storage);
+    EXPECT_TRUE(x.EqMatrix(a.InverseMatrix() * b));
+  }
+}
+
+TEST(Lu, MatrixSolve) {
+  S21Matrix a(3, 3);
+  a(0, 1) = 2.0;
+  a(1, 0) = 1.0;
+  a(1, 2) = 1.0;
+  a(2, 0) = 3.0;
+  a(2, 2) = 1.0;
+  S21Matrix b(3, 1);
+  b(0, 0) = 4.0;
+  b(1, 0) = 3.0;
+  b(2, 0) = 7.0;
+  S21Matrix expected(3, 1);
+  expected(0, 0) = 2.0;
+  expected(1, 0) = 2.0;
+  expected(2, 0) = 1.0;
+  EXPECT_TRUE(a.Solve(b).EqMatrix(expected));
+  // Блок [[0, 2], [1, 0]] и правая часть (4, 3): x = (3, 2).
+  const S21MatrixView block = S21MatrixView(a).Block(0, 0, 2, 2);
+  const S21Matrix x = block.Solve(S21MatrixView(b).Block(0, 0, 2, 1));
+  EXPECT_DOUBLE_EQ(x(0, 0), 3.0);
+  EXPECT_DOUBLE_EQ(x(1, 0), 2.0);
+}
+
+TEST(Lu, Errors) {
+  S21Matrix singular(3, 3);
+  for (int i = 0; i < 3; i++) singular(i, 0) = i;
+  S21Lu lu(singular);
+  EXPECT_TRUE(lu.IsSingular());
+  EXPECT_EQ(lu.Determinant(), 0.0);
+  EXPECT_THROW(lu.Solve(S21Matrix(3, 1)), std::runtime_error);
+  EXPECT_THROW(lu.InverseMatrix(), std::runtime_error);
+  EXPECT_THROW(singular.Solve(S21Matrix(3, 1)), std::runtime_error);
+
+  S21Lu regular(Regular(3));
+  EXPECT_THROW(regular.Solve(S21Matrix(2, 1)), std::invalid_argument);
+  EXPECT_THROW(S21Lu{S21Matrix(2, 3)}, std::invalid_argument);
+  EXPECT_THROW(S21Lu{S21Matrix()}, std::runtime_error);
+  EXPECT_THROW(S21Matrix(2, 3).Solve(S21Matrix(2, 1)), std::invalid_argument);
+}
@@ -0,0 +1,79 @@
+#include "../s21_matrix_batch.h"
+
+#include "../s21_simd.h"
+
+namespace {
+
+// Матрица k пакета: диагонально преобладающая, чтобы была обратимой.
+template <int N>
+S21FixedMatrix<N, N> Sample(int k) {
+  S21FixedMatrix<N, N> result;
+  for (int i = 0; i < N; i++) {
+    for (int j = 0; j < N; j++) {
+      result(i, j) =
+          i == j ? N + 1.0 + k % 5 : ((i * 7 + j * 3 + k) % 11) / 11.0;
+    }
+  }
+  return result;
+}
+
+template <int N>
+void ExpectMatchesFixed(int size) {
+  S21MatrixBatch<N> a(size);
+  S21MatrixBatch<N> b(size);
+  for (int k = 0; k < size; k++) {
+    a.Set(k, Sample<N>(k));
+    b.Set(k, Sample<N>(k + 3).Transpose());
+  }
+  const std::vector<double> det = a.Determinant();
+  const S21MatrixBatch<N> inverse = a.InverseMatrix();
+  const S21MatrixBatch<N> transposed = a.Transpose();
+  S21MatrixBatch<N> product(a);
+  product.MulMatrix(b);
+  ASSERT_EQ(det.size(), static_cast<std::size_t>(size));
+  for (int k = 0; k < size; k++) {
+    const S21FixedMatrix<N, N> x = Sample<N>(k);
+    EXPECT_NEAR(det[k], x.Determinant(), 1e-9);
+    EXPECT_TRUE(inverse.Get(k).EqMatrix(x.InverseMatrix()));
+    EXPECT_TRUE(transposed.Get(k) == x.Transpose());
+    EXPECT_TRUE(product.Get(k) == x * Sample<N>(k + 3).Transpose());
+  }
+}
+
+}  // namespace
+
+TEST(MatrixBatch, MatchesFixedMatrixOnEveryIsa) {
+  const s21::simd::Isa saved = s21::simd::ActiveIsa();
+  for (s21::simd::Isa isa :
+       {s21::simd::Isa::kScalar, s21::simd::Isa::kSse2, s21::simd::Isa::kAvx2,
+        s21::simd::Isa::kAvx512}) {
+    if (s21::simd::SetActiveIsa(isa)) {
+      ExpectMatchesFixed<2>(5);
+      ExpectMatchesFixed<3>(17);
+      ExpectMatchesFixed<4>(16);
+    }
+  }
+  s21::simd::SetActiveIsa(saved);
+}
+
+TEST(MatrixBatch, AccessAndErrors) {
+  S21MatrixBatch<3> batch(9);
+  EXPECT_EQ(batch.GetSize(), 9);
+  EXPECT_EQ(S21MatrixBatch<3>::GetRows(), 3);
+  batch(8, 2, 1) = 4.5;
+  EXPECT_DOUBLE_EQ(batch.Get(8)(2, 1), 4.5);
+  EXPECT_DOUBLE_EQ(batch.Groups()[1].e[7][0], 4.5);
+  EXPECT_THROW(batch(9, 0, 0), std::out_of_range);
+  EXPECT_THROW(batch(0, 3, 0), std::out_of_range);
+  EXPECT_THROW(batch.Get(-1), std::out_of_range);
+  EXPECT_THROW(S21MatrixBatch<3>(0), std::invalid_argument);
+  S21MatrixBatch<3> other(8);
+  EXPECT_THROW(batch.MulMatrix(other), std::invalid_argument);
+
+  // Нулевые матрицы вырождены; хвост группы ошибку не вызывает.
+  for (int k = 0; k < 9; k++) batch.Set(k, Sample<3>(k));
+  EXPECT_NO_THROW(batch.InverseMatrix());
+  batch.Set(4, S21FixedMatrix<3, 3>{1, 2, 3, 2, 4, 6, 0, 0, 1});
+  EXPECT_DOUBLE_EQ(batch.Determinant()[4], 0.0);
+  EXPECT_THROW(batch.InverseMatrix(), std::runtime_error);
+}
@@ -1582,7 +1582,611 @@ TEST(MatrixOperations, SimpleArithmeticWithNegativeInfinity) {
 
   EXPECT_THROW(a.SimpleArithmetic(b, -1), std::runtime_error);
 }
+
+TEST(Constructors, ContiguousStorage) {
+  S21Matrix a(3, 4);
+  double **rows = a.getMatrix();
+  for (int i = 1; i < a.GetRows(); i++) {
+    EXPECT_EQ(rows[i], rows[i - 1] + a.GetCols());
+  }
+}
+
+TEST(Constructors, CopyIsDeep) {
+  S21Matrix a(2, 3);
+  a(1, 2) = 7.0;
+  S21Matrix b(a);
+  EXPECT_NE(a.getMatrix()[0], b.getMatrix()[0]);
+  a(1, 2) = 1.0;
+  EXPECT_DOUBLE_EQ(b(1, 2), 7.0);
+}
+
+TEST(Constructors, AlignedLayoutStride) {
+  S21Matrix a(3, 5, S21Matrix::Layout::kAligned);
+  EXPECT_EQ(a.GetLayout(), S21Matrix::Layout::kAligned);
+  EXPECT_EQ(a.GetCols(), 5);
+  EXPECT_EQ(a.GetStride(), 8);
+  for (int i = 0; i < a.GetRows(); i++) {
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(a.getMatrix()[i]) %
+                  S21Matrix::kAlignment,
+              0u);
+  }
+  S21Matrix b(4, 512, S21Matrix::Layout::kAligned);
+  EXPECT_EQ(b.GetStride(), 520);
+  S21Matrix c(2, 5);
+  EXPECT_EQ(c.GetStride(), 5);
+}
+
+TEST(Operations, AlignedLayoutMixedArithmetic) {
+  S21Matrix a(2, 3, S21Matrix::Layout::kAligned);
+  S21Matrix b(2, 3);
+  for (int i = 0; i < 2; i++) {
+    for (int j = 0; j < 3; j++) {
+      a(i, j) = i * 3 + j;
+      b(i, j) = 1.0;
+    }
+  }
+  S21Matrix c = a + b;
+  EXPECT_EQ(c.GetLayout(), S21Matrix::Layout::kAligned);
+  EXPECT_DOUBLE_EQ(c(1, 2), 6.0);
+  b = a;
+  EXPECT_EQ(b.GetStride(), a.GetStride());
+  EXPECT_TRUE(b == a);
+  a.SetCols(4);
+  a.SetRows(3);
+  EXPECT_DOUBLE_EQ(a(1, 2), 5.0);
+  EXPECT_DOUBLE_EQ(a(2, 3), 0.0);
+}
+
+TEST(Operations, MulMatrixBlockedMatchesNaive) {
+  const int m = 133, k = 261, n = 77;
+  S21Matrix a(m, k);
+  S21Matrix b(k, n, S21Matrix::Layout::kAligned);
+  for (int i = 0; i < m; i++) {
+    for (int j = 0; j < k; j++) a(i, j) = ((i * 7 + j * 3) % 11) - 5.0;
+  }
+  for (int i = 0; i < k; i++) {
+    for (int j = 0; j < n; j++) b(i, j) = ((i * 5 + j) % 13) * 0.25;
+  }
+  S21Matrix c = a * b;
+  ASSERT_EQ(c.GetRows(), m);
+  ASSERT_EQ(c.GetCols(), n);
+  for (int i = 0; i < m; i++) {
+    for (int j = 0; j < n; j++) {
+      double expected = 0.0;
+      for (int p = 0; p < k; p++) expected += a(i, p) * b(p, j);
+      EXPECT_NEAR(c(i, j), expected, 1e-9);
+    }
+  }
+}
+
+TEST(Operations, DeterminantNeedsPivoting) {
+  S21Matrix m(3, 3);
+  m(0, 1) = 2.0;
+  m(1, 0) = 3.0;
+  m(2, 2) = 4.0;
+  EXPECT_DOUBLE_EQ(m.Determinant(), -24.0);
+}
+
+TEST(Operations, DeterminantLarge) {
+  // A = L * U с единичной L и диагональю U из двоек: det = 2^n.
+  const int n = 150;
+  S21Matrix l(n, n);
+  S21Matrix u(n, n);
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      if (j < i) l(i, j) = ((i + j) % 5) * 0.1;
+      if (j > i) u(i, j) = ((i * j) % 7) * 0.1;
+    }
+    l(i, i) = 1.0;
+    u(i, i) = 2.0;
+  }
+  S21Matrix a = l * u;
+  EXPECT_NEAR(a.Determinant() / std::pow(2.0, n), 1.0, 1e-6);
+}
+
+TEST(Operations, DeterminantSingularLarge) {
+  S21Matrix m(70, 70);
+  for (int i = 0; i < 70; i++) {
+    for (int j = 0; j < 70; j++) m(i, j) = i + j;
+  }
+  EXPECT_NEAR(m.Determinant(), 0.0, 1e-6);
+}
+
+TEST(Operations, InverseMatrixLarge) {
+  const int n = 90;
+  S21Matrix a(n, n);
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) a(i, j) = ((i * 13 + j * 7) % 17) * 0.1;
+    a(i, i) += n;
+  }
+  S21Matrix product = a * a.InverseMatrix();
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      EXPECT_NEAR(product(i, j), i == j ? 1.0 : 0.0, 1e-10);
+    }
+  }
+}
+
+TEST(Operations, InverseMatrixNonSquare) {
+  S21Matrix a(2, 3);
+  EXPECT_THROW(a.InverseMatrix(), std::invalid_argument);
+}
+
+TEST(Operations, InverseMatrixSingularLarge) {
+  S21Matrix a(80, 80);
+  for (int i = 0; i < 80; i++) {
+    a(i, 0) = i;
+    a(i, 1) = 2.0 * i;
+    for (int j = 2; j < 80; j++) a(i, j) = (i == j) ? 1.0 : 0.0;
+  }
+  EXPECT_THROW(a.InverseMatrix(), std::runtime_error);
+}
+
+TEST(Operations, InverseMatrixNumericallySingular) {
+  // После округления ведущие элементы LU не точный ноль, а ~eps * max|a|.
+  for (int n : {3, 4}) {
+    S21Matrix a(n, n);
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < n; j++) a(i, j) = i * n + j + 1;
+    }
+    EXPECT_EQ(a.Determinant(), 0.0);
+    EXPECT_THROW(a.InverseMatrix(), std::runtime_error);
+  }
+}
+
+TEST(Operations, CalcComplementsLargeMatchesMinors) {
+  const int n = 6;
+  S21Matrix a(n, n);
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) a(i, j) = ((i * 5 + j * 3) % 7) - 2.0;
+    a(i, i) += 4.0;
+  }
+  S21Matrix result = a.CalcComplements();
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      double expected = ((i + j) % 2 == 0 ? 1 : -1) *
+                        a.GetMinor(i, j).Determinant();
+      EXPECT_NEAR(result(i, j), expected, 1e-8 * (1.0 + std::abs(expected)));
+    }
+  }
+}
+
+TEST(Operations, CalcComplementsSingular) {
+  // Ранг n - 1: присоединённая матрица ненулевая, хотя det = 0.
+  S21Matrix a(4, 4);
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 4; j++) a(i, j) = (i == j) ? 2.0 : 1.0;
+  }
+  for (int j = 0; j < 4; j++) a(3, j) = a(0, j) + a(1, j);
+  S21Matrix result = a.CalcComplements();
+  EXPECT_NEAR(result(3, 3), 4.0, 1e-12);
+  // A * adj(A) = det(A) * I = 0.
+  S21Matrix product = a * result.Transpose();
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 4; j++) EXPECT_NEAR(product(i, j), 0.0, 1e-12);
+  }
+}
+
+TEST(Operations, CalcComplementsRankDeficient) {
+  // Ранг 2 < n - 1: все миноры вырождены, дополнения — точные нули, а не
+  // det(A) * A^-T из шума округления.
+  for (int n : {4, 5}) {
+    S21Matrix a(n, n);
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < n; j++) a(i, j) = i * n + j + 1;
+    }
+    S21Matrix result = a.CalcComplements();
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < n; j++) EXPECT_EQ(result(i, j), 0.0);
+    }
+  }
+}
+
+TEST(Operators, FusedExpression) {
+  S21Matrix a(2, 2);
+  S21Matrix b(2, 2);
+  S21Matrix c(2, 2);
+  for (int i = 0; i < 2; i++) {
+    for (int j = 0; j < 2; j++) {
+      a(i, j) = i + j;
+      b(i, j) = 10.0;
+      c(i, j) = i * 2 + j;
+    }
+  }
+  S21Matrix result = a + b - c * 2.0;
+  EXPECT_DOUBLE_EQ(result(0, 0), 10.0);
+  EXPECT_DOUBLE_EQ(result(0, 1), 9.0);
+  EXPECT_DOUBLE_EQ(result(1, 0), 7.0);
+  EXPECT_DOUBLE_EQ(result(1, 1), 6.0);
+  result = 0.5 * (result + result);
+  EXPECT_DOUBLE_EQ(result(1, 1), 6.0);
+}
+
+TEST(Operators, ExpressionAliasesDestination) {
+  S21Matrix a(2, 3);
+  S21Matrix b(2, 3);
+  a(1, 2) = 1.0;
+  b(1, 2) = 2.0;
+  double *before = a.getMatrix()[0];
+  a = a + b * 3.0;
+  EXPECT_EQ(a.getMatrix()[0], before);
+  EXPECT_DOUBLE_EQ(a(1, 2), 7.0);
+  a += b - a;
+  EXPECT_DOUBLE_EQ(a(1, 2), 2.0);
+  a -= b * 2.0;
+  EXPECT_DOUBLE_EQ(a(1, 2), -2.0);
+}
+
+TEST(Operators, ExpressionWithTemporaries) {
+  S21Matrix a(2, 2);
+  a(0, 0) = 1.0;
+  a(1, 1) = 1.0;
+  S21Matrix c(2, 2);
+  c(0, 1) = 5.0;
+  S21Matrix result = (a * a) + c;
+  EXPECT_DOUBLE_EQ(result(0, 0), 1.0);
+  EXPECT_DOUBLE_EQ(result(0, 1), 5.0);
+  S21Matrix product = (a + a) * c;
+  EXPECT_DOUBLE_EQ(product(0, 1), 10.0);
+  S21Matrix product2 = c * (a + a);
+  EXPECT_DOUBLE_EQ(product2(0, 1), 10.0);
+}
+
+TEST(Operators, ExpressionErrors) {
+  S21Matrix a(2, 2);
+  S21Matrix b(2, 2);
+  S21Matrix c(3, 2);
+  EXPECT_THROW(a + b - c, std::invalid_argument);
+  EXPECT_THROW((a + b) * std::numeric_limits<double>::infinity(),
+               std::invalid_argument);
+  EXPECT_THROW(a += c * 2.0, std::invalid_argument);
+  b(0, 0) = std::numeric_limits<double>::quiet_NaN();
+  EXPECT_THROW(S21Matrix r = a + b, std::runtime_error);
+}
+
+// Как у MulNumber и SumMatrix: проверяются только операнды + и -, а не
+// результат, и при ошибке приёмник не меняется.
+TEST(Operators, ExpressionFinitenessMatchesMethods) {
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  const double inf = std::numeric_limits<double>::infinity();
+  S21Matrix a(2, 3);
+  a(0, 1) = nan;
+  a(1, 2) = inf;
+  S21Matrix scaled = a * 2.0;
+  EXPECT_TRUE(std::isnan(scaled(0, 1)));
+  EXPECT_EQ(scaled(1, 2), inf);
+  S21Matrix copy(a);
+  copy *= 2.0;
+  EXPECT_TRUE(std::isnan(copy(0, 1)));
+
+  S21Matrix big(2, 3);
+  big(1, 1) = std::numeric_limits<double>::max();
+  S21Matrix sum = big + big;
+  EXPECT_EQ(sum(1, 1), inf);
+  S21Matrix method(big);
+  method.SumMatrix(big);
+  EXPECT_EQ(method(1, 1), inf);
+  EXPECT_THROW(S21Matrix r = sum + big, std::runtime_error);
+
+  S21Matrix target(2, 3);
+  for (int j = 0; j < 3; j++) target(0, j) = j + 1.0;
+  S21Matrix other(2, 3);
+  other(1, 2) = nan;
+  EXPECT_THROW(target = target + other, std::runtime_error);
+  EXPECT_THROW(target += other * 2.0, std::runtime_error);
+  EXPECT_THROW(target -= big - other, std::runtime_error);
+  for (int j = 0; j < 3; j++) EXPECT_EQ(target(0, j), j + 1.0);
+  target = a * 0.0;
+  EXPECT_TRUE(std::isnan(target(0, 1)));
+}
+
+TEST(Operators, RvalueOperandBufferReused) {
+  S21Matrix a(3, 3);
+  S21Matrix b(3, 3);
+  for (int i = 0; i < 3; i++) {
+    a(i, i) = 2.0;
+    b(i, 2 - i) = 1.0;
+  }
+  S21Matrix temp = a * b;
+  const double* storage = temp.getMatrix()[0];
+  S21Matrix sum = std::move(temp) + a;
+  EXPECT_EQ(sum.getMatrix()[0], storage);
+  EXPECT_EQ(temp.getMatrix(), nullptr);
+  EXPECT_DOUBLE_EQ(sum(0, 0), 2.0);
+  EXPECT_DOUBLE_EQ(sum(0, 2), 2.0);
+
+  S21Matrix rhs = a * 1.0;
+  storage = rhs.getMatrix()[0];
+  S21Matrix diff = b - std::move(rhs) * 0.5;
+  EXPECT_EQ(diff.getMatrix()[0], storage);
+  EXPECT_DOUBLE_EQ(diff(0, 0), -1.0);
+  EXPECT_DOUBLE_EQ(diff(0, 2), 1.0);
+}
+
+TEST(Operators, ReusedBufferKeepsLeftmostLayout) {
+  S21Matrix packed(3, 5);
+  S21Matrix aligned(3, 5, S21Matrix::Layout::kAligned);
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 5; j++) {
+      packed(i, j) = i + j;
+      aligned(i, j) = i * j;
+    }
+  }
+  S21Matrix copy(aligned);
+  // Временная матрица справа с другой раскладкой не забирается.
+  const double* storage = aligned.getMatrix()[0];
+  S21Matrix sum = packed + std::move(aligned);
+  EXPECT_NE(sum.getMatrix()[0], storage);
+  EXPECT_EQ(sum.GetLayout(), S21Matrix::Layout::kPacked);
+  EXPECT_EQ(sum.GetStride(), 5);
+  EXPECT_DOUBLE_EQ(sum(2, 4), 14.0);
+
+  storage = copy.getMatrix()[0];
+  S21Matrix diff = std::move(copy) - packed;
+  EXPECT_EQ(diff.getMatrix()[0], storage);
+  EXPECT_EQ(diff.GetLayout(), S21Matrix::Layout::kAligned);
+  EXPECT_DOUBLE_EQ(diff(2, 4), 2.0);
+}
+
+TEST(Operators, RvalueAssignmentChangesDimensions) {
+  S21Matrix a(2, 3);
+  a(1, 2) = 4.0;
+  S21Matrix result(5, 5);
+  result = S21Matrix(a) * 2.0 + a;
+  EXPECT_EQ(result.GetRows(), 2);
+  EXPECT_EQ(result.GetCols(), 3);
+  EXPECT_DOUBLE_EQ(result(1, 2), 12.0);
+  S21Matrix b(2, 2);
+  EXPECT_THROW(result = S21Matrix(a) * b, std::invalid_argument);
+  EXPECT_EQ(result.GetRows(), 2);
+}
+
+TEST(Accessors, UncheckedAccessAndRows) {
+  S21Matrix a(3, 4, S21Matrix::Layout::kAligned);
+  for (int i = 0; i < 3; i++) {
+    for (double& value : a.Row(i)) value = i + 1.0;
+  }
+  a.At(2, 3) = 7.0;
+  EXPECT_EQ(a.Row(1).size(), 4u);
+  EXPECT_EQ(a.Row(1).data(), a.getMatrix()[1]);
+  EXPECT_DOUBLE_EQ(a(1, 2), 2.0);
+  EXPECT_DOUBLE_EQ(a(2, 3), 7.0);
+  const double* data = a.Data();
+  EXPECT_EQ(data, &a.At(0, 0));
+  EXPECT_DOUBLE_EQ(data[2 * a.GetStride() + 3], 7.0);
+  S21Matrix empty;
+  EXPECT_EQ(empty.Data(), nullptr);
+}
+
+TEST(Accessors, GetMinorEdges) {
+  S21Matrix a(3, 3);
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) a(i, j) = i * 3 + j;
+  }
+  S21Matrix first = a.GetMinor(0, 0);
+  EXPECT_DOUBLE_EQ(first(0, 0), 4.0);
+  EXPECT_DOUBLE_EQ(first(1, 1), 8.0);
+  S21Matrix last = a.GetMinor(2, 2);
+  EXPECT_DOUBLE_EQ(last(0, 0), 0.0);
+  EXPECT_DOUBLE_EQ(last(1, 1), 4.0);
+  S21Matrix middle = a.GetMinor(1, 1);
+  EXPECT_DOUBLE_EQ(middle(0, 1), 2.0);
+  EXPECT_DOUBLE_EQ(middle(1, 0), 6.0);
+  EXPECT_THROW(a.GetMinor(3, 0), std::out_of_range);
+}
+
+namespace {
+
+S21Matrix Numbered(int rows, int cols, S21Matrix::Layout layout) {
+  S21Matrix result(rows, cols, layout);
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) result(i, j) = i * 1000.0 + j;
+  }
+  return result;
+}
+
+void ExpectTransposed(const S21Matrix& source, const S21Matrix& result) {
+  ASSERT_EQ(result.GetRows(), source.GetCols());
+  ASSERT_EQ(result.GetCols(), source.GetRows());
+  for (int i = 0; i < source.GetRows(); i++) {
+    for (int j = 0; j < source.GetCols(); j++) {
+      ASSERT_DOUBLE_EQ(result(j, i), source(i, j));
+    }
+  }
+}
+
+}  // namespace
+
+TEST(Operations, TransposeBlockedLarge) {
+  for (S21Matrix::Layout layout :
+       {S21Matrix::Layout::kPacked, S21Matrix::Layout::kAligned}) {
+    S21Matrix a = Numbered(67, 131, layout);
+    S21Matrix result = a.Transpose();
+    EXPECT_EQ(result.GetLayout(), layout);
+    ExpectTransposed(a, result);
+  }
+}
+
+TEST(Operations, TransposeInPlaceSquare) {
+  S21Matrix a = Numbered(97, 97, S21Matrix::Layout::kAligned);
+  S21Matrix copy(a);
+  const double* storage = a.Data();
+  a.TransposeInPlace();
+  EXPECT_EQ(a.Data(), storage);
+  ExpectTransposed(copy, a);
+}
+
+TEST(Operations, TransposeInPlaceRectangular) {
+  for (S21Matrix::Layout layout :
+       {S21Matrix::Layout::kPacked, S21Matrix::Layout::kAligned}) {
+    S21Matrix tall = Numbered(70, 41, layout);
+    S21Matrix copy(tall);
+    const double* storage = tall.Data();
+    tall.TransposeInPlace();
+    EXPECT_EQ(tall.Data(), storage);
+    EXPECT_EQ(tall.GetStride(), S21Matrix(41, 70, layout).GetStride());
+    ExpectTransposed(copy, tall);
+    // У широкой матрицы не хватает таблицы строк: новый буфер.
+    tall.TransposeInPlace();
+    EXPECT_TRUE(tall.EqMatrix(copy));
+  }
+  S21Matrix row = Numbered(1, 5, S21Matrix::Layout::kPacked);
+  row.TransposeInPlace();
+  EXPECT_EQ(row.GetRows(), 5);
+  EXPECT_DOUBLE_EQ(row(4, 0), 4.0);
+  S21Matrix empty;
+  EXPECT_THROW(empty.TransposeInPlace(), std::runtime_error);
+}
+
+TEST(Operations, GemmMatchesOperators) {
+  for (int n : {5, 70}) {
+    S21Matrix a = Numbered(n + 3, n, S21Matrix::Layout::kPacked) * 1e-3;
+    S21Matrix b = Numbered(n + 3, n + 1, S21Matrix::Layout::kAligned) * 1e-3;
+    S21Matrix c = Numbered(n, n + 1, S21Matrix::Layout::kPacked) * 1e-3;
+    S21Matrix expected = a.Transpose() * b * 2.0 + c * 0.5;
+    c.Gemm(2.0, a, b, 0.5, true, false);
+    EXPECT_TRUE(c.EqMatrix(expected));
+
+    S21Matrix d(n + 3, n + 3);
+    d.Gemm(1.0, a, a, 0.0, false, true);
+    EXPECT_TRUE(d.EqMatrix(a * a.Transpose()));
+    S21Matrix e(n, n + 1);
+    e.Gemm(-1.0, a, b.Transpose(), 3.0, true, true);
+    EXPECT_TRUE(e.EqMatrix(a.Transpose() * b * -1.0));
+  }
+}
+
+TEST(Operations, GemmAliasingAndErrors) {
+  S21Matrix c = Numbered(40, 40, S21Matrix::Layout::kAligned) * 1e-3;
+  S21Matrix expected = c * c + c;
+  c.Gemm(1.0, c, c, 1.0);
+  EXPECT_TRUE(c.EqMatrix(expected));
+
+  S21Matrix a(3, 4);
+  S21Matrix b(4, 2);
+  S21Matrix out(3, 2);
+  EXPECT_THROW(out.Gemm(1.0, a, b, 0.0, true), std::invalid_argument);
+  EXPECT_THROW(out.Gemm(std::numeric_limits<double>::infinity(), a, b, 0.0),
+               std::invalid_argument);
+  S21Matrix empty;
+  EXPECT_THROW(empty.Gemm(1.0, a, b, 0.0), std::runtime_error);
+  out(0, 0) = 5.0;
+  out.Gemm(1.0, a, b, 0.0);
+  EXPECT_DOUBLE_EQ(out(0, 0), 0.0);
+}
+
+TEST(Mutators, SetRowsAppendIsAmortized) {
+  S21Matrix m(1, 3);
+  m(0, 2) = 2.0;
+  int reallocations = 0;
+  for (int i = 1; i < 1000; i++) {
+    const double* storage = m.Data();
+    m.SetRows(i + 1);
+    reallocations += m.Data() != storage;
+    EXPECT_GE(m.GetRowCapacity(), m.GetRows());
+    for (int j = 0; j < 3; j++) {
+      EXPECT_DOUBLE_EQ(m(i, j), 0.0);
+      m(i, j) = i * 3 + j;
+    }
+  }
+  EXPECT_LE(reallocations, 10);
+  for (int i = 0; i < 1000; i++) {
+    EXPECT_DOUBLE_EQ(m(i, 2), i * 3 + 2);
+  }
+}
+
+TEST(Mutators, ShrinkKeepsStorage) {
+  S21Matrix m(4, 5, S21Matrix::Layout::kAligned);
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 5; j++) m(i, j) = i * 5 + j + 1;
+  }
+  const double* storage = m.Data();
+  m.SetRows(2);
+  m.SetCols(3);
+  EXPECT_EQ(m.Data(), storage);
+  EXPECT_EQ(m.GetRowCapacity(), 4);
+  EXPECT_EQ(m.GetColCapacity(), 8);
+  EXPECT_THROW(m(2, 0), std::out_of_range);
+  m.SetRows(4);
+  m.SetCols(5);
+  EXPECT_EQ(m.Data(), storage);
+  EXPECT_DOUBLE_EQ(m(1, 2), 8.0);
+  EXPECT_DOUBLE_EQ(m(1, 3), 0.0);
+  EXPECT_DOUBLE_EQ(m(3, 0), 0.0);
+  S21Matrix expected(4, 5);
+  for (int i = 0; i < 2; i++) {
+    for (int j = 0; j < 3; j++) expected(i, j) = i * 5 + j + 1;
+  }
+  EXPECT_TRUE(m.EqMatrix(expected));
+}
+
+TEST(Mutators, Reserve) {
+  S21Matrix m(2, 5);
+  m(1, 4) = 7.0;
+  m.Reserve(6, 9);
+  EXPECT_EQ(m.GetRows(), 2);
+  EXPECT_EQ(m.GetCols(), 5);
+  EXPECT_GE(m.GetRowCapacity(), 6);
+  EXPECT_GE(m.GetColCapacity(), 9);
+  EXPECT_DOUBLE_EQ(m(1, 4), 7.0);
+  const double* storage = m.Data();
+  m.Reserve(1, 1);
+  m.SetRows(6);
+  m.SetCols(9);
+  EXPECT_EQ(m.Data(), storage);
+  EXPECT_DOUBLE_EQ(m(1, 4), 7.0);
+  EXPECT_DOUBLE_EQ(m(5, 8), 0.0);
+  // Зарезервированных строк хватает широкой матрице для транспонирования
+  // на месте.
+  S21Matrix wide(2, 5);
+  wide(1, 4) = 3.0;
+  wide.Reserve(5, 5);
+  storage = wide.Data();
+  wide.TransposeInPlace();
+  EXPECT_EQ(wide.Data(), storage);
+  EXPECT_EQ(wide.GetRows(), 5);
+  EXPECT_DOUBLE_EQ(wide(4, 1), 3.0);
+  wide.SetRows(wide.GetRowCapacity());
+  EXPECT_DOUBLE_EQ(wide(wide.GetRows() - 1, 1), 0.0);
+  EXPECT_THROW(m.Reserve(0, 3), std::invalid_argument);
+  S21Matrix empty;
+  EXPECT_THROW(empty.Reserve(2, 2), std::runtime_error);
+}
+
+TEST(Operations, EqMatrixToleranceModes) {
+  S21Matrix a(3, 17);
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 17; j++) a(i, j) = (i + 1) * 1e6 + j;
+  }
+  S21Matrix b(a);
+  b(2, 16) += 1e-4;
+  EXPECT_FALSE(a.EqMatrix(b));
+  EXPECT_TRUE(a.EqMatrix(b, S21Matrix::Tolerance::Absolute(1e-3)));
+  EXPECT_TRUE(a.EqMatrix(b, S21Matrix::Tolerance::Relative(1e-10)));
+  EXPECT_FALSE(a.EqMatrix(b, S21Matrix::Tolerance::Relative(1e-12)));
+  b(2, 16) = std::nextafter(a(2, 16), 0.0);
+  EXPECT_TRUE(a.EqMatrix(b, S21Matrix::Tolerance::Ulp(1)));
+  EXPECT_FALSE(a.EqMatrix(b, S21Matrix::Tolerance::Ulp(0)));
+  EXPECT_TRUE(a.EqMatrix(b, S21Matrix::Tolerance::Ulp(1e30)));
+  // Между -DBL_MAX и DBL_MAX почти 2^64 ULP: больший порог насыщается.
+  S21Matrix low(1, 1), high(1, 1);
+  low(0, 0) = -std::numeric_limits<double>::max();
+  high(0, 0) = std::numeric_limits<double>::max();
+  EXPECT_TRUE(low.EqMatrix(
+      high, S21Matrix::Tolerance::Ulp(std::numeric_limits<double>::max())));
+  EXPECT_FALSE(low.EqMatrix(high, S21Matrix::Tolerance::Ulp(0x1p63)));
+  EXPECT_TRUE(S21MatrixView(a).Minor(2, 16).EqMatrix(
+      S21MatrixView(b).Minor(2, 16), S21Matrix::Tolerance::Ulp(0)));
+  EXPECT_THROW(a.EqMatrix(b, S21Matrix::Tolerance::Relative(-1.0)),
+               std::invalid_argument);
+  EXPECT_THROW(a.EqMatrix(b, S21Matrix::Tolerance::Absolute(NAN)),
+               std::invalid_argument);
+  S21Matrix empty;
+  EXPECT_THROW(a.EqMatrix(empty, S21Matrix::kDefaultTolerance),
+               std::runtime_error);
+}
+
 int main(int argc, char** argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
-}
\ No newline at end of file
+}
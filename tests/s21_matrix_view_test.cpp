@@ -0,0 +1,93 @@
+#include "../s21_matrix_view.h"
+
+#include "s21_test_helpers.h"
+
+TEST(MatrixView, WholeMatrixSharesStorage) {
+  S21Matrix a = Filled(3, 4);
+  S21MatrixView view(a);
+  EXPECT_EQ(view.GetRows(), 3);
+  EXPECT_EQ(view.GetCols(), 4);
+  EXPECT_EQ(view.RowData(1), a.getMatrix()[1]);
+  a(2, 3) = -5.0;
+  EXPECT_DOUBLE_EQ(view(2, 3), -5.0);
+  EXPECT_THROW(view(3, 0), std::out_of_range);
+  S21Matrix empty;
+  EXPECT_THROW(S21MatrixView{empty}, std::runtime_error);
+}
+
+TEST(MatrixView, BlockAndMinorIndexing) {
+  S21Matrix a = Filled(5, 5);
+  S21MatrixView block = S21MatrixView(a).Block(1, 2, 3, 2);
+  EXPECT_EQ(block.GetRows(), 3);
+  EXPECT_DOUBLE_EQ(block(0, 0), a(1, 2));
+  EXPECT_DOUBLE_EQ(block(2, 1), a(3, 3));
+  EXPECT_TRUE(block.ToMatrix().EqMatrix(block));
+
+  S21MatrixView minor = S21MatrixView(a).Minor(1, 2);
+  S21Matrix copy = a.GetMinor(1, 2);
+  EXPECT_TRUE(copy.EqMatrix(minor));
+  EXPECT_TRUE(minor.EqMatrix(copy));
+  EXPECT_DOUBLE_EQ(minor(1, 2), a(2, 3));
+
+  // Блок минора, пересекающий исключённые строку и столбец.
+  S21MatrixView inner = minor.Block(0, 1, 3, 3);
+  EXPECT_DOUBLE_EQ(inner(0, 0), a(0, 1));
+  EXPECT_DOUBLE_EQ(inner(1, 1), a(2, 3));
+  EXPECT_DOUBLE_EQ(inner(2, 2), a(3, 4));
+  S21MatrixView tail = minor.Block(2, 2, 2, 2);
+  EXPECT_DOUBLE_EQ(tail(0, 0), a(3, 3));
+  EXPECT_TRUE(tail.EqMatrix(S21MatrixView(a).Block(3, 3, 2, 2)));
+
+  EXPECT_THROW(minor.Minor(0, 0), std::invalid_argument);
+  EXPECT_THROW(S21MatrixView(a).Minor(5, 0), std::out_of_range);
+  EXPECT_THROW(S21MatrixView(a).Block(4, 0, 2, 1), std::out_of_range);
+  EXPECT_THROW(S21MatrixView(a).Block(0, 0, 0, 1), std::invalid_argument);
+}
+
+TEST(MatrixView, ReadOnlyOperationsMatchCopies) {
+  S21Matrix a = Filled(6, 6);
+  // Диагональное преобладание: миноры обратимы.
+  for (int i = 0; i < 6; i++) a(i, i) += 10.0;
+  S21MatrixView minor = S21MatrixView(a).Minor(2, 4);
+  S21Matrix copy = a.GetMinor(2, 4);
+  EXPECT_NEAR(minor.Determinant(), copy.Determinant(), 1e-6);
+  EXPECT_TRUE(minor.Transpose().EqMatrix(copy.Transpose()));
+  EXPECT_TRUE(minor.InverseMatrix().EqMatrix(copy.InverseMatrix()));
+  EXPECT_TRUE(minor.CalcComplements().EqMatrix(copy.CalcComplements()));
+  EXPECT_TRUE((minor * minor).EqMatrix(copy * copy));
+  EXPECT_TRUE((copy * minor).EqMatrix(copy * copy));
+
+  S21MatrixView small = S21MatrixView(a).Block(1, 1, 3, 3).Minor(0, 0);
+  EXPECT_NEAR(small.Determinant(), a(2, 2) * a(3, 3) - a(2, 3) * a(3, 2),
+              1e-9);
+  EXPECT_THROW(S21MatrixView(a).Block(0, 0, 2, 3).Determinant(),
+               std::invalid_argument);
+}
+
+TEST(MatrixView, MatrixMethodsAcceptViews) {
+  S21Matrix a = Filled(4, 4);
+  S21Matrix b(3, 3);
+  b.SumMatrix(S21MatrixView(a).Minor(0, 0));
+  EXPECT_DOUBLE_EQ(b(0, 0), a(1, 1));
+  EXPECT_DOUBLE_EQ(b(2, 2), a(3, 3));
+  b.SubMatrix(S21MatrixView(a).Block(1, 1, 3, 3));
+  EXPECT_TRUE(b.EqMatrix(S21Matrix(3, 3)));
+  EXPECT_THROW(b.SumMatrix(S21MatrixView(a)), std::invalid_argument);
+
+  S21Matrix c = S21MatrixView(a).Block(0, 0, 2, 3).ToMatrix();
+  S21Matrix expected = c * a.GetMinor(3, 0);
+  c.MulMatrix(S21MatrixView(a).Minor(3, 0));
+  EXPECT_TRUE(c.EqMatrix(expected));
+
+  S21Matrix sum = a.GetMinor(0, 0) + S21MatrixView(a).Minor(0, 0) * 2.0;
+  EXPECT_DOUBLE_EQ(sum(1, 2), 3.0 * a(2, 3));
+}
+
+TEST(MatrixView, RawPointerView) {
+  double data[2][4] = {{1, 2, 3, 0}, {4, 5, 6, 0}};
+  S21MatrixView view(&data[0][0], 2, 3, 4);
+  EXPECT_DOUBLE_EQ(view(1, 2), 6.0);
+  EXPECT_EQ(view.ToMatrix().GetLayout(), S21Matrix::Layout::kPacked);
+  EXPECT_THROW(S21MatrixView(&data[0][0], 2, 5, 4), std::invalid_argument);
+  EXPECT_THROW(S21MatrixView(nullptr, 2, 3, 4), std::runtime_error);
+}
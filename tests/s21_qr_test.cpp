@@ -0,0 +1,89 @@
+#include "../s21_qr.h"
+
+#include "../s21_matrix_view.h"
+
+namespace {
+
+// Высокая матрица m x n полного ранга.
+S21Matrix Tall(int m, int n) {
+  S21Matrix a(m, n);
+  for (int i = 0; i < m; i++) {
+    for (int j = 0; j < n; j++) {
+      a(i, j) = ((i * 7 + j * 13) % 17) / 17.0 - 0.5 + (i == j ? 2.0 : 0.0);
+    }
+  }
+  return a;
+}
+
+}  // namespace
+
+TEST(Qr, FactorMatchesMatrix) {
+  for (auto [m, n] : {std::pair{1, 1}, {5, 3}, {64, 64}, {200, 150}}) {
+    const S21Matrix a = Tall(m, n);
+    S21Qr qr(a);
+    EXPECT_TRUE(qr.IsFullRank());
+    const S21Matrix q = qr.GetQ();
+    const S21Matrix r = qr.GetR();
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < i; j++) EXPECT_EQ(r(i, j), 0.0);
+    }
+    S21Matrix identity(n, n);
+    for (int i = 0; i < n; i++) identity(i, i) = 1.0;
+    S21Matrix qtq(n, n);
+    qtq.Gemm(1.0, q, q, 0.0, true, false);
+    EXPECT_TRUE(qtq.EqMatrix(identity, S21Matrix::Tolerance::Absolute(1e-12)));
+    EXPECT_TRUE((q * r).EqMatrix(a, S21Matrix::Tolerance::Absolute(1e-12)));
+  }
+}
+
+TEST(Qr, LeastSquaresMatchesNormalEquations) {
+  const int m = 300, n = 70;
+  const S21Matrix a = Tall(m, n);
+  S21Matrix b(m, 2);
+  for (int i = 0; i < m; i++) {
+    b(i, 0) = i % 5;
+    b(i, 1) = std::sin(i * 0.1);
+  }
+  const S21Matrix x = S21Qr(a).Solve(b);
+  ASSERT_EQ(x.GetRows(), n);
+  ASSERT_EQ(x.GetCols(), 2);
+  // Невязка ортогональна столбцам A: A^T (A x - b) = 0.
+  S21Matrix residual = b;
+  residual.Gemm(1.0, a, x, -1.0);
+  S21Matrix gradient(n, 2);
+  gradient.Gemm(1.0, a, residual, 0.0, true, false);
+  EXPECT_TRUE(gradient.EqMatrix(S21Matrix(n, 2),
+                                S21Matrix::Tolerance::Absolute(1e-9)));
+  S21Matrix normal(n, n);
+  normal.Gemm(1.0, a, a, 0.0, true, false);
+  S21Matrix rhs(n, 2);
+  rhs.Gemm(1.0, a, b, 0.0, true, false);
+  EXPECT_TRUE(x.EqMatrix(normal.Solve(rhs)));
+  EXPECT_TRUE(S21MatrixView(a).Solve(b).EqMatrix(x));
+}
+
+TEST(Qr, ExactSystem) {
+  S21Matrix a = Tall(4, 2);
+  S21Matrix x(2, 1);
+  x(0, 0) = 1.5;
+  x(1, 0) = -2.0;
+  const S21Matrix b = a * x;
+  S21Qr qr(std::move(a));
+  EXPECT_EQ(a.Data(), nullptr);
+  EXPECT_EQ(qr.GetR().GetRows(), 2);
+  EXPECT_TRUE(qr.Solve(b).EqMatrix(x));
+  EXPECT_TRUE(qr.Solve(S21MatrixView(b)).EqMatrix(x));
+}
+
+TEST(Qr, Errors) {
+  S21Matrix dependent = Tall(6, 3);
+  for (int i = 0; i < 6; i++) dependent(i, 2) = 2.0 * dependent(i, 0);
+  S21Qr qr(dependent);
+  EXPECT_FALSE(qr.IsFullRank());
+  EXPECT_THROW(qr.Solve(S21Matrix(6, 1)), std::runtime_error);
+  EXPECT_THROW(dependent.Solve(S21Matrix(6, 1)), std::runtime_error);
+  EXPECT_THROW(S21Qr(Tall(6, 2)).Solve(S21Matrix(5, 1)),
+               std::invalid_argument);
+  EXPECT_THROW(S21Qr{S21Matrix(2, 3)}, std::invalid_argument);
+  EXPECT_THROW(S21Qr{S21Matrix()}, std::runtime_error);
+}
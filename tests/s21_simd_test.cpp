@@ -0,0 +1,168 @@
+#include "../s21_simd.h"
+
+#include <limits>
+#include <vector>
+
+#include "../s21_matrix_oop.h"
+
+namespace {
+
+// Прогоняет проверку на каждом наборе инструкций, доступном процессору.
+template <class Check>
+void ForEachIsa(Check check) {
+  const s21::simd::Isa saved = s21::simd::ActiveIsa();
+  for (s21::simd::Isa isa :
+       {s21::simd::Isa::kScalar, s21::simd::Isa::kSse2,
+        s21::simd::Isa::kAvx2, s21::simd::Isa::kAvx512}) {
+    if (s21::simd::SetActiveIsa(isa)) {
+      SCOPED_TRACE(s21::simd::IsaName(isa));
+      check();
+    }
+  }
+  s21::simd::SetActiveIsa(saved);
+}
+
+// Вызов из динамической инициализации: порядок относительно s21_simd.cpp
+// не определён, ядра должны выбираться при первом обращении.
+const double kStaticDot = [] {
+  const double a[] = {1.0, 2.0, 3.0};
+  return s21::simd::Dot(a, a, 3);
+}();
+
+}  // namespace
+
+TEST(Simd, DetectedIsaIsActiveByDefault) {
+  EXPECT_TRUE(s21::simd::SetActiveIsa(s21::simd::Isa::kScalar));
+  EXPECT_TRUE(s21::simd::SetActiveIsa(s21::simd::DetectIsa()));
+  EXPECT_EQ(s21::simd::ActiveIsa(), s21::simd::DetectIsa());
+}
+
+TEST(Simd, UsableFromStaticInitializers) { EXPECT_EQ(kStaticDot, 14.0); }
+
+TEST(Simd, KernelsMatchScalarOnAllIsas) {
+  ForEachIsa([] {
+    for (int n : {1, 3, 8, 17, 64}) {
+      std::vector<double> a(n), b(n);
+      for (int j = 0; j < n; j++) {
+        a[j] = j * 0.5;
+        b[j] = 1.0 - j;
+      }
+      EXPECT_TRUE(s21::simd::AddScaled(a.data(), b.data(), -1.0, n));
+      s21::simd::Scale(a.data(), 2.0, n);
+      for (int j = 0; j < n; j++) {
+        EXPECT_DOUBLE_EQ(a[j], 2.0 * (j * 0.5 - (1.0 - j)));
+      }
+      std::vector<double> c(a);
+      EXPECT_TRUE(s21::simd::WithinTolerance(a.data(), c.data(), 1e-7, n));
+      c[n - 1] += 1e-3;
+      EXPECT_FALSE(s21::simd::WithinTolerance(a.data(), c.data(), 1e-7, n));
+    }
+  });
+}
+
+// sign * b округляется до сложения на всех наборах (без FMA), поэтому
+// результат побитово совпадает со скалярным.
+TEST(Simd, AddScaledBitwiseEqualOnAllIsas) {
+  const int n = 19;
+  const double eps = std::numeric_limits<double>::epsilon();
+  std::vector<double> expected(n, -1.0);
+  const std::vector<double> b(n, 1.0 + eps);
+  const s21::simd::Isa saved = s21::simd::ActiveIsa();
+  s21::simd::SetActiveIsa(s21::simd::Isa::kScalar);
+  s21::simd::AddScaled(expected.data(), b.data(), 1.0 + eps, n);
+  s21::simd::SetActiveIsa(saved);
+  EXPECT_EQ(expected[0], 2.0 * eps);
+  ForEachIsa([&] {
+    std::vector<double> a(n, -1.0);
+    EXPECT_TRUE(s21::simd::AddScaled(a.data(), b.data(), 1.0 + eps, n));
+    for (int j = 0; j < n; j++) EXPECT_EQ(a[j], expected[j]);
+  });
+}
+
+TEST(Simd, DotOnAllIsas) {
+  ForEachIsa([] {
+    for (int n : {0, 1, 7, 8, 33, 70}) {
+      std::vector<double> a(n), b(n);
+      double expected = 0.0;
+      for (int j = 0; j < n; j++) {
+        a[j] = j % 5 - 2.0;
+        b[j] = j + 1.0;
+        expected += a[j] * b[j];
+      }
+      // Целые значения складываются точно в любом порядке.
+      EXPECT_EQ(s21::simd::Dot(a.data(), b.data(), n), expected) << n;
+    }
+  });
+}
+
+TEST(Simd, NonFiniteDetectedInEveryLane) {
+  ForEachIsa([] {
+    const int n = 19;
+    for (int bad = 0; bad < n; bad++) {
+      std::vector<double> a(n, 1.0), b(n, 2.0);
+      b[bad] = std::numeric_limits<double>::quiet_NaN();
+      EXPECT_FALSE(s21::simd::AddScaled(a.data(), b.data(), 1.0, n));
+      std::vector<double> c(n, 1.0), d(n, 2.0);
+      c[bad] = -std::numeric_limits<double>::infinity();
+      EXPECT_FALSE(s21::simd::AddScaled(c.data(), d.data(), 1.0, n));
+    }
+  });
+}
+
+TEST(Simd, MatrixOperationsOnAllIsas) {
+  ForEachIsa([] {
+    S21Matrix a(5, 11, S21Matrix::Layout::kAligned);
+    S21Matrix b(5, 11);
+    for (int i = 0; i < 5; i++) {
+      for (int j = 0; j < 11; j++) {
+        a(i, j) = i - j;
+        b(i, j) = i + j;
+      }
+    }
+    a.SumMatrix(b);
+    a.MulNumber(0.5);
+    EXPECT_DOUBLE_EQ(a(4, 10), 4.0);
+    S21Matrix c(a);
+    EXPECT_TRUE(a.EqMatrix(c));
+    c(4, 10) += 1.0;
+    EXPECT_FALSE(a.EqMatrix(c));
+  });
+}
+
+TEST(Simd, RelativeAndUlpComparison) {
+  ForEachIsa([] {
+    const int n = 21;
+    std::vector<double> a(n), b(n);
+    for (int j = 0; j < n; j++) {
+      a[j] = (j % 2 == 0 ? 1.0 : -1.0) * std::ldexp(1.0 + j, j * 40 - 400);
+      b[j] = std::nextafter(a[j], 0.0);
+    }
+    EXPECT_TRUE(s21::simd::WithinRelative(a.data(), b.data(), 1e-15, n));
+    EXPECT_TRUE(s21::simd::WithinUlps(a.data(), b.data(), 1, n));
+    EXPECT_FALSE(s21::simd::WithinUlps(a.data(), b.data(), 0, n));
+    for (int bad = 0; bad < n; bad++) {
+      std::vector<double> c(a);
+      c[bad] *= 1.0 + 1e-9;
+      EXPECT_FALSE(s21::simd::WithinRelative(a.data(), c.data(), 1e-12, n));
+      EXPECT_TRUE(s21::simd::WithinRelative(a.data(), c.data(), 1e-8, n));
+      EXPECT_FALSE(s21::simd::WithinUlps(a.data(), c.data(), 1000, n));
+      c[bad] = std::numeric_limits<double>::quiet_NaN();
+      EXPECT_FALSE(s21::simd::WithinRelative(c.data(), c.data(), 1.0, n));
+      EXPECT_FALSE(s21::simd::WithinUlps(c.data(), c.data(), 1000, n));
+    }
+    // Числа разных знаков у нуля: расстояние в ULP через ноль.
+    const double tiny = std::numeric_limits<double>::denorm_min();
+    std::vector<double> x(n, 0.0), y(n, -0.0);
+    EXPECT_TRUE(s21::simd::WithinUlps(x.data(), y.data(), 0, n));
+    x[n - 1] = tiny;
+    y[n - 1] = -tiny;
+    EXPECT_TRUE(s21::simd::WithinUlps(x.data(), y.data(), 2, n));
+    EXPECT_FALSE(s21::simd::WithinUlps(x.data(), y.data(), 1, n));
+    x[0] = std::numeric_limits<double>::max();
+    y[0] = -std::numeric_limits<double>::max();
+    EXPECT_FALSE(s21::simd::WithinUlps(
+        x.data(), y.data(), std::numeric_limits<std::int64_t>::max(), n));
+    EXPECT_TRUE(s21::simd::WithinUlps(
+        x.data(), y.data(), std::numeric_limits<std::uint64_t>::max(), n));
+  });
+}
@@ -0,0 +1,130 @@
+#include "../s21_sparse_matrix.h"
+
+#include <vector>
+
+#include "../s21_thread_pool.h"
+
+namespace {
+
+// Плотная матрица с нулями в большинстве позиций.
+S21Matrix SparseDense(int rows, int cols, int seed) {
+  S21Matrix result(rows, cols);
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) {
+      if ((i * 7 + j * 13 + seed) % 5 == 0) result(i, j) = i - j + seed * 0.5;
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST(SparseMatrix, RoundTripAndAccess) {
+  S21Matrix dense = SparseDense(6, 9, 1);
+  dense(2, 3) = 0.0;
+  S21SparseMatrix sparse(dense);
+  EXPECT_EQ(sparse.GetRows(), 6);
+  EXPECT_EQ(sparse.GetCols(), 9);
+  EXPECT_EQ(sparse.RowBegin().size(), 7u);
+  EXPECT_EQ(sparse.RowBegin().back(), sparse.GetNonZeros());
+  EXPECT_LT(sparse.GetNonZeros(), 54u / 4);
+  EXPECT_TRUE(sparse.ToMatrix() == dense);
+  for (int i = 0; i < 6; i++) {
+    for (int j = 0; j < 9; j++) EXPECT_DOUBLE_EQ(sparse(i, j), dense(i, j));
+  }
+  EXPECT_THROW(sparse(6, 0), std::out_of_range);
+  EXPECT_THROW(sparse(0, -1), std::out_of_range);
+  EXPECT_THROW(S21SparseMatrix(0, 3), std::invalid_argument);
+  S21SparseMatrix minor(S21MatrixView(dense).Minor(1, 1));
+  EXPECT_TRUE(minor.ToMatrix() == dense.GetMinor(1, 1));
+}
+
+TEST(SparseMatrix, FromTripletsSumsDuplicates) {
+  const std::vector<S21SparseMatrix::Triplet> triplets = {
+      {2, 1, 1.0}, {0, 3, 2.0}, {2, 0, 4.0}, {2, 1, 0.5}, {1, 2, 3.0},
+      {1, 2, -3.0}};
+  S21SparseMatrix sparse = S21SparseMatrix::FromTriplets(3, 4, triplets);
+  EXPECT_EQ(sparse.GetNonZeros(), 3u);
+  EXPECT_DOUBLE_EQ(sparse(2, 1), 1.5);
+  EXPECT_DOUBLE_EQ(sparse(2, 0), 4.0);
+  EXPECT_DOUBLE_EQ(sparse(1, 2), 0.0);
+  EXPECT_EQ(sparse.ColIndex()[1], 0);
+  EXPECT_EQ(sparse.ColIndex()[2], 1);
+  const std::vector<S21SparseMatrix::Triplet> bad = {{3, 0, 1.0}};
+  EXPECT_THROW(S21SparseMatrix::FromTriplets(3, 4, bad), std::out_of_range);
+}
+
+TEST(SparseMatrix, ArithmeticMatchesDense) {
+  S21Matrix a = SparseDense(7, 5, 2);
+  S21Matrix b = SparseDense(7, 5, 3);
+  S21Matrix x = SparseDense(5, 4, 4) + S21Matrix(5, 4) * 0.0;
+  S21SparseMatrix sa(a);
+  S21SparseMatrix sb(b);
+  EXPECT_TRUE((sa + sb).ToMatrix() == S21Matrix(a + b));
+  EXPECT_TRUE((sa - sb).ToMatrix() == S21Matrix(a - b));
+  S21SparseMatrix zero(sa);
+  zero.SubMatrix(sa);
+  EXPECT_EQ(zero.GetNonZeros(), 0u);
+  zero.SumMatrix(sb);
+  EXPECT_TRUE(zero.ToMatrix() == b);
+  EXPECT_TRUE((sa * x) == a * x);
+  EXPECT_TRUE((sa * S21MatrixView(x).Block(0, 1, 5, 3)) ==
+              a * S21MatrixView(x).Block(0, 1, 5, 3));
+
+  std::vector<double> v(5);
+  for (int j = 0; j < 5; j++) v[j] = j + 1.0;
+  const std::vector<double> y = sa * v;
+  ASSERT_EQ(y.size(), 7u);
+  for (int i = 0; i < 7; i++) {
+    double expected = 0.0;
+    for (int j = 0; j < 5; j++) expected += a(i, j) * v[j];
+    EXPECT_DOUBLE_EQ(y[i], expected);
+  }
+  EXPECT_THROW(sa + S21SparseMatrix(5, 7), std::invalid_argument);
+  EXPECT_THROW(sa * a, std::invalid_argument);
+  EXPECT_THROW(sa * std::vector<double>(7), std::invalid_argument);
+}
+
+// 1 000 000 x 1 000 000: плотная матрица заняла бы 8 ТБ.
+TEST(SparseMatrix, MillionByMillion) {
+  const int n = 1000000;
+  std::vector<S21SparseMatrix::Triplet> triplets;
+  for (int i = 0; i < n; i += 1000) {
+    triplets.push_back({i, i, 2.0});
+    triplets.push_back({i, n - 1 - i, 1.0});
+  }
+  const S21SparseMatrix a = S21SparseMatrix::FromTriplets(n, n, triplets);
+  EXPECT_EQ(a.GetNonZeros(), 2000u);
+  std::vector<double> x(n);
+  for (int i = 0; i < n; i++) x[i] = i;
+  const std::vector<double> y = a * x;
+  EXPECT_DOUBLE_EQ(y[0], n - 1.0);
+  EXPECT_DOUBLE_EQ(y[1], 0.0);
+  EXPECT_DOUBLE_EQ(y[5000], 2.0 * 5000 + (n - 1 - 5000));
+  const S21SparseMatrix doubled = a + a;
+  EXPECT_DOUBLE_EQ(doubled(5000, n - 5001), 2.0);
+  S21Matrix block(n, 2);
+  block(n - 1, 1) = 3.0;
+  EXPECT_DOUBLE_EQ((a * block)(0, 1), 3.0);
+}
+
+TEST(SparseMatrix, ParallelProductsMatchSerial) {
+  const int n = 3000;
+  std::vector<S21SparseMatrix::Triplet> triplets;
+  for (int i = 0; i < n; i++) {
+    for (int k = 0; k < 1 + i % 40; k++) {
+      triplets.push_back({i, (i * 31 + k * 97) % n, 1.0 + k});
+    }
+  }
+  const S21SparseMatrix a = S21SparseMatrix::FromTriplets(n, n, triplets);
+  S21Matrix dense(n, 24);
+  for (int i = 0; i < n; i++) dense(i, i % 24) = i;
+  s21::ThreadPool &pool = s21::ThreadPool::Instance();
+  const int threads = pool.GetThreadCount();
+  pool.SetThreadCount(1);
+  const S21Matrix serial = a * dense;
+  pool.SetThreadCount(4);
+  const S21Matrix parallel = a * dense;
+  pool.SetThreadCount(threads);
+  EXPECT_TRUE(serial.EqMatrix(parallel, S21Matrix::Tolerance::Ulp(0)));
+}
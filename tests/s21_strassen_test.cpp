@@ -0,0 +1,55 @@
+#include "../s21_strassen.h"
+
+#include "../s21_matrix_oop.h"
+#include "../s21_matrix_view.h"
+#include "s21_test_helpers.h"
+
+// Малый порог включает несколько уровней рекурсии и дополнение нулями на
+// размерах, которые быстро считаются.
+TEST(Strassen, MatchesClassical) {
+  for (auto [m, n, k] : {std::tuple{64, 64, 64}, {100, 100, 100},
+                         {33, 45, 71}, {129, 67, 90}, {8, 200, 8}}) {
+    const S21Matrix a = Filled(m, k, 1);
+    const S21Matrix b = Filled(k, n, 2);
+    S21Matrix c(m, n);
+    s21::StrassenGemm(m, n, k, a.Data(), a.GetStride(), b.Data(),
+                      b.GetStride(), c.Data(), c.GetStride(), 8);
+    EXPECT_TRUE(c.EqMatrix(a * b, S21Matrix::Tolerance::Absolute(1e-11)))
+        << m << "x" << k << " * " << k << "x" << n;
+  }
+}
+
+TEST(Strassen, StridedOperands) {
+  const S21Matrix a = Filled(70, 80, 3);
+  const S21Matrix b = Filled(90, 60, 4);
+  S21Matrix c(50, 70, S21Matrix::Layout::kAligned);
+  c(0, 0) = 1e300;
+  s21::StrassenGemm(48, 41, 64, a.Data(), a.GetStride(), b.Data(),
+                    b.GetStride(), c.Data(), c.GetStride(), 16);
+  const S21Matrix expected = S21MatrixView(a).Block(0, 0, 48, 64) *
+                             S21MatrixView(b).Block(0, 0, 64, 41);
+  EXPECT_TRUE(S21MatrixView(c).Block(0, 0, 48, 41).EqMatrix(expected));
+  EXPECT_EQ(c(48, 0), 0.0);
+  EXPECT_EQ(c(0, 41), 0.0);
+}
+
+TEST(Strassen, MulMatrixAlgorithm) {
+  S21Matrix a = Filled(30, 20, 5);
+  const S21Matrix b = Filled(20, 10, 6);
+  const S21Matrix expected = a * b;
+  a.MulMatrix(b, S21Matrix::MulAlgorithm::kStrassen);
+  EXPECT_TRUE(a.EqMatrix(expected));
+  S21Matrix c = Filled(30, 19, 5);
+  S21Matrix d = c;
+  c.MulMatrix(S21MatrixView(b).Minor(19, 9),
+              S21Matrix::MulAlgorithm::kStrassen);
+  d.MulMatrix(S21MatrixView(b).Minor(19, 9),
+              S21Matrix::MulAlgorithm::kClassical);
+  EXPECT_EQ(c.GetCols(), 9);
+  EXPECT_TRUE(c.EqMatrix(d));
+  EXPECT_THROW(a.MulMatrix(b, S21Matrix::MulAlgorithm::kStrassen),
+               std::invalid_argument);
+  S21Matrix empty;
+  EXPECT_THROW(empty.MulMatrix(b, S21Matrix::MulAlgorithm::kStrassen),
+               std::runtime_error);
+}
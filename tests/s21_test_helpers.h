@@ -0,0 +1,20 @@
+#ifndef S21_TEST_HELPERS_H
+#define S21_TEST_HELPERS_H
+
+#include "../s21_matrix_oop.h"
+
+// Детерминированная матрица rows x cols для тестов. Элементы — кратные
+// 1/8 из [-1, 1.75], поэтому произведения и суммы небольшого числа таких
+// элементов вычисляются точно при любом порядке сложения. Разные seed дают
+// разные матрицы одного размера.
+inline S21Matrix Filled(int rows, int cols, int seed = 0) {
+  S21Matrix result(rows, cols);
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) {
+      result(i, j) = ((i * 31 + j * 17 + seed) % 23) * 0.125 - 1.0;
+    }
+  }
+  return result;
+}
+
+#endif
@@ -0,0 +1,97 @@
+#include "../s21_thread_pool.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "../s21_matrix_oop.h"
+#include "s21_test_helpers.h"
+
+namespace {
+
+// Восстанавливает размер пула после теста.
+class PoolSizeGuard {
+ public:
+  PoolSizeGuard() : saved_(s21::ThreadPool::Instance().GetThreadCount()) {}
+  ~PoolSizeGuard() { s21::ThreadPool::Instance().SetThreadCount(saved_); }
+
+ private:
+  int saved_;
+};
+
+}  // namespace
+
+TEST(ThreadPool, RunsEveryTaskOnce) {
+  PoolSizeGuard guard;
+  s21::ThreadPool &pool = s21::ThreadPool::Instance();
+  pool.SetThreadCount(4);
+  EXPECT_EQ(pool.GetThreadCount(), 4);
+  std::vector<std::atomic<int>> hits(1000);
+  pool.ParallelFor(1000, [&](int task) { hits[task]++; });
+  for (const auto &hit : hits) {
+    EXPECT_EQ(hit.load(), 1);
+  }
+}
+
+TEST(ThreadPool, NestedCallsRunInline) {
+  PoolSizeGuard guard;
+  s21::ThreadPool &pool = s21::ThreadPool::Instance();
+  pool.SetThreadCount(3);
+  std::atomic<int> total(0);
+  pool.ParallelFor(8, [&](int) {
+    pool.ParallelFor(4, [&](int) { total++; });
+  });
+  EXPECT_EQ(total.load(), 32);
+}
+
+TEST(ThreadPool, PropagatesException) {
+  PoolSizeGuard guard;
+  s21::ThreadPool &pool = s21::ThreadPool::Instance();
+  pool.SetThreadCount(4);
+  EXPECT_THROW(pool.ParallelFor(64,
+                                [](int task) {
+                                  if (task == 13) {
+                                    throw std::runtime_error("task failed");
+                                  }
+                                }),
+               std::runtime_error);
+  std::atomic<int> total(0);
+  pool.ParallelFor(16, [&](int) { total++; });
+  EXPECT_EQ(total.load(), 16);
+}
+
+TEST(ThreadPool, InvalidThreadCount) {
+  EXPECT_THROW(s21::ThreadPool::Instance().SetThreadCount(0),
+               std::invalid_argument);
+}
+
+TEST(ThreadPool, SetThreadCountFromTaskThrows) {
+  PoolSizeGuard guard;
+  s21::ThreadPool &pool = s21::ThreadPool::Instance();
+  for (int threads : {1, 3}) {
+    pool.SetThreadCount(threads);
+    std::atomic<int> thrown(0);
+    pool.ParallelFor(6, [&](int) {
+      try {
+        pool.SetThreadCount(threads + 1);
+      } catch (const std::logic_error &) {
+        thrown++;
+      }
+    });
+    EXPECT_EQ(thrown.load(), 6);
+    EXPECT_EQ(pool.GetThreadCount(), threads);
+  }
+  pool.SetThreadCount(2);
+  EXPECT_EQ(pool.GetThreadCount(), 2);
+}
+
+TEST(ThreadPool, ParallelMulMatrixMatchesSerial) {
+  PoolSizeGuard guard;
+  S21Matrix a = Filled(300, 270, 1);
+  S21Matrix b = Filled(270, 520, 2);
+  s21::ThreadPool::Instance().SetThreadCount(1);
+  S21Matrix serial = a * b;
+  s21::ThreadPool::Instance().SetThreadCount(4);
+  S21Matrix parallel = a * b;
+  EXPECT_TRUE(serial == parallel);
+}
@@ -0,0 +1,123 @@
+#include "../s21_vector.h"
+
+#include <limits>
+
+#include "../s21_sparse_matrix.h"
+#include "../s21_thread_pool.h"
+#include "s21_test_helpers.h"
+
+namespace {
+
+S21Vector Ramp(int size) {
+  S21Vector v(size);
+  for (int i = 0; i < size; i++) v(i) = i % 7 - 3.0;
+  return v;
+}
+
+}  // namespace
+
+TEST(Vector, Construction) {
+  S21Vector v{1.0, 2.0, 3.0};
+  EXPECT_EQ(v.GetSize(), 3);
+  EXPECT_EQ(v(2), 3.0);
+  v.At(0) = 5.0;
+  const std::span<const double> span = v;
+  EXPECT_EQ(span[0], 5.0);
+  EXPECT_EQ(S21Vector(span).GetSize(), 3);
+  EXPECT_EQ(S21Vector().GetSize(), 0);
+  EXPECT_THROW(v(3), std::out_of_range);
+  EXPECT_THROW(v(-1), std::out_of_range);
+  EXPECT_THROW(S21Vector(0), std::invalid_argument);
+  EXPECT_THROW(S21Vector(std::initializer_list<double>{}),
+               std::invalid_argument);
+  EXPECT_THROW(S21Vector(std::span<const double>()), std::invalid_argument);
+}
+
+// Элементы кратны 1/8: результат точен при любом порядке сложения, поэтому
+// сравнивается с MulMatrix напрямую, в том числе на крупных размерах с
+// пулом потоков.
+TEST(Vector, MatchesMulMatrix) {
+  for (auto [m, n] : {std::pair{1, 1}, {3, 5}, {130, 70}, {600, 2100}}) {
+    const S21Matrix a = Filled(m, n);
+    const S21Vector x = Ramp(n);
+    const S21Vector z = Ramp(m);
+    S21Matrix column(n, 1);
+    for (int j = 0; j < n; j++) column(j, 0) = x(j);
+    S21Matrix row(1, m);
+    for (int i = 0; i < m; i++) row(0, i) = z(i);
+    const S21Matrix expected = a * column;
+    const S21Matrix expected_t = row * a;
+    const S21Vector y = a * x;
+    const S21Vector y_t = z * a;
+    ASSERT_EQ(y.GetSize(), m);
+    ASSERT_EQ(y_t.GetSize(), n);
+    for (int i = 0; i < m; i++) EXPECT_EQ(y(i), expected(i, 0));
+    for (int j = 0; j < n; j++) EXPECT_EQ(y_t(j), expected_t(0, j));
+  }
+}
+
+TEST(Vector, ParallelMatchesSerial) {
+  const S21Matrix a = Filled(700, 1500);
+  const S21Vector x = Ramp(1500);
+  const S21Vector z = Ramp(700);
+  s21::ThreadPool &pool = s21::ThreadPool::Instance();
+  const int threads = pool.GetThreadCount();
+  pool.SetThreadCount(1);
+  const S21Vector serial = a * x;
+  const S21Vector serial_t = z * a;
+  pool.SetThreadCount(4);
+  const S21Vector parallel = a * x;
+  const S21Vector parallel_t = z * a;
+  pool.SetThreadCount(threads);
+  for (int i = 0; i < 700; i++) EXPECT_EQ(serial(i), parallel(i));
+  for (int j = 0; j < 1500; j++) EXPECT_EQ(serial_t(j), parallel_t(j));
+}
+
+TEST(Vector, GemvAccumulatesAndAliases) {
+  const S21Matrix a = Filled(4, 4);
+  S21Vector y{1.0, 2.0, 3.0, 4.0};
+  const S21Vector x = y;
+  const S21Vector ax = a * x;
+  y.Gemv(2.0, a, y, -1.0);
+  for (int i = 0; i < 4; i++) EXPECT_EQ(y(i), 2.0 * ax(i) - x(i));
+
+  // Минор с исключённым столбцом и транспонированием.
+  const S21Matrix b = Filled(5, 4);
+  const S21MatrixView minor = S21MatrixView(b).Minor(2, 1);
+  S21Vector r{1.0, 1.0, 1.0};
+  r.Gemv(1.0, minor, S21Vector{1.0, 0.0, 0.0, 2.0}, 1.0, true);
+  EXPECT_EQ(r(0), 1.0 + b(0, 0) + 2.0 * b(4, 0));
+  EXPECT_EQ(r(1), 1.0 + b(0, 2) + 2.0 * b(4, 2));
+  EXPECT_EQ(r(2), 1.0 + b(0, 3) + 2.0 * b(4, 3));
+}
+
+TEST(Vector, ZeroAlphaSkipsMatrix) {
+  S21Matrix a = Filled(3, 3);
+  a(1, 1) = std::numeric_limits<double>::infinity();
+  a(2, 0) = std::numeric_limits<double>::quiet_NaN();
+  const S21Vector x{1.0, 2.0, 3.0};
+  for (bool transpose : {false, true}) {
+    S21Vector y{1.0, -2.0, 4.0};
+    y.Gemv(0.0, a, x, 0.5, transpose);
+    EXPECT_EQ(y(0), 0.5);
+    EXPECT_EQ(y(1), -1.0);
+    EXPECT_EQ(y(2), 2.0);
+    y.Gemv(0.0, a, x, 0.0, transpose);
+    for (int i = 0; i < 3; i++) EXPECT_EQ(y(i), 0.0);
+  }
+}
+
+TEST(Vector, SparseAndErrors) {
+  const S21Matrix a = Filled(5, 6);
+  const S21Vector x = Ramp(6);
+  const std::vector<double> sparse = S21SparseMatrix(a) * x;
+  const S21Vector dense = a * x;
+  for (int i = 0; i < 5; i++) EXPECT_EQ(sparse[i], dense(i));
+
+  S21Vector y(5);
+  EXPECT_THROW(y.Gemv(1.0, a, Ramp(5), 0.0), std::invalid_argument);
+  EXPECT_THROW(y.Gemv(1.0, a, x, 0.0, true), std::invalid_argument);
+  EXPECT_THROW(y.Gemv(NAN, a, x, 0.0), std::invalid_argument);
+  EXPECT_THROW(S21Matrix() * x, std::runtime_error);
+  EXPECT_THROW(Ramp(6) * a, std::invalid_argument);
+}